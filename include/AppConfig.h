@@ -15,6 +15,12 @@ extern "C" {
 #endif
 
 /* Enumerations */
+typedef enum {
+    EProcessGroup_PROCESS_PRESSURE = 0,
+    EProcessGroup_PROCESS_TEMPERATURE = 1,
+    EProcessGroup_PROCESS_EGT = 2,
+    EProcessGroup_PROCESS_BME280 = 3
+} EProcessGroup;
 typedef enum {
     EThermocoupleType_TC_TYPE_B = 0,
     EThermocoupleType_TC_TYPE_E = 1,
@@ -63,6 +69,16 @@ typedef enum {
     EPressurePreset_PRESSURE_PRESET_400_PSIG = 29,
     EPressurePreset_PRESSURE_PRESET_500_PSIG = 30
 } EPressurePreset;
+typedef enum {
+    EFilterType_FILTER_NONE = 0,
+    EFilterType_FILTER_EMA = 1,
+    EFilterType_FILTER_IIR2 = 2
+} EFilterType;
+typedef enum {
+    ESpnHold_SPN_HOLD_LATEST = 0,
+    ESpnHold_SPN_HOLD_MAX = 1,
+    ESpnHold_SPN_HOLD_MIN = 2
+} ESpnHold;
 typedef enum {
     ESpnCategory_SPN_CAT_TEMPERATURE = 0,
     ESpnCategory_SPN_CAT_PRESSURE = 1,
@@ -78,13 +94,56 @@ typedef struct TTempInputConfig {
     float coeffB;
     float coeffC;
     float resistorValue;
+    uint8_t samplePriority;
+    uint8_t dataRate;
+    uint8_t sampleReserved[2];
 } TTempInputConfig;
 typedef struct TPressureInputConfig {
     EValueId assignedValue;
     uint16_t maxPressure;
     EPressureType pressureType;
-    uint8_t reserved;
+    uint8_t samplePriority;
+    uint8_t dataRate;
 } TPressureInputConfig;
+typedef struct TValueFilterConfig {
+    EFilterType filterType;
+    uint16_t timeConstantMs;
+} TValueFilterConfig;
+typedef struct TValueGlitchConfig {
+    uint8_t medianWindow;
+    uint8_t glitchReserved;
+    uint16_t maxRatePerSec;
+} TValueGlitchConfig;
+typedef struct TCurvePoint {
+    uint16_t millivolts;
+    int16_t valueTenths;
+} TCurvePoint;
+typedef struct TCurveConfig {
+    uint8_t inputType;
+    uint8_t input;
+    uint8_t pointCount;
+    uint8_t curveReserved;
+    TCurvePoint points[32];
+} TCurveConfig;
+typedef struct TStatsConfig {
+    uint8_t valueId;
+    uint8_t statsReserved;
+    uint16_t windowSec;
+} TStatsConfig;
+typedef struct TPulsationConfig {
+    uint8_t inputMask;
+    uint8_t cylinders;
+    uint8_t windowMs;
+    uint8_t pulsationReserved;
+} TPulsationConfig;
+typedef struct TAlarmConfig {
+    uint8_t valueId;
+    uint8_t alarmReserved;
+    int16_t lowTenths;
+    int16_t highTenths;
+    uint16_t hysteresisTenths;
+    uint16_t debounceMs;
+} TAlarmConfig;
 typedef struct THardwareMapping {
     uint8_t adsDevice;
     uint8_t adsChannel;
@@ -106,6 +165,14 @@ typedef struct AppConfig {
     uint8_t tcReserved[2];
     bool bme280Enabled;
     uint8_t bme280Reserved[3];
+    TValueFilterConfig valueFilters[EValueId_VALUE_ID_COUNT];
+    TValueGlitchConfig valueGlitch[EValueId_VALUE_ID_COUNT];
+    TCurveConfig curves[2];
+    TStatsConfig stats[4];
+    uint8_t spnHold[24];
+    TPulsationConfig pulsation;
+    TAlarmConfig alarms[8];
+    uint16_t processPeriodMs[4];
     uint32_t checksum;
 } AppConfig;
 
@@ -115,6 +182,24 @@ extern const uint8_t CONFIG_VERSION;
 extern const uint8_t TEMP_INPUT_COUNT;
 extern const uint8_t PRESSURE_INPUT_COUNT;
 extern const uint8_t ADS_DEVICE_COUNT;
+extern const uint8_t ADS_DATA_RATE_COUNT;
+extern const uint16_t ADS_DATA_RATE_SPS[8];
+extern const uint8_t SAMPLE_PRIORITY_MAX;
+extern const uint8_t DEFAULT_TEMP_PRIORITY;
+extern const uint8_t DEFAULT_TEMP_DATA_RATE;
+extern const uint8_t DEFAULT_PRESSURE_PRIORITY;
+extern const uint8_t DEFAULT_PRESSURE_DATA_RATE;
+extern const uint8_t CURVE_SLOT_COUNT;
+extern const uint8_t CURVE_POINT_MAX;
+extern const uint8_t STATS_SLOT_COUNT;
+extern const uint8_t SPN_HOLD_COUNT;
+extern const uint8_t DEFAULT_PULSATION_CYLINDERS;
+extern const uint8_t DEFAULT_PULSATION_WINDOW_MS;
+extern const uint8_t ALARM_SLOT_COUNT;
+extern const int16_t ALARM_NO_LOW;
+extern const int16_t ALARM_NO_HIGH;
+extern const uint8_t PROCESS_GROUP_COUNT;
+extern const uint16_t DEFAULT_PROCESS_PERIOD_MS;
 extern AppConfig appConfig;
 extern const float AEM_TEMP_COEFF_A;
 extern const float AEM_TEMP_COEFF_B;
@@ -132,6 +217,7 @@ extern const THardwareMapping TEMP_HARDWARE_MAP[8];
 extern const THardwareMapping PRESSURE_HARDWARE_MAP[7];
 extern const uint8_t ADS_I2C_ADDRESSES[4];
 extern const uint8_t ADS_DRDY_PINS[4];
+extern const uint32_t SENSOR_I2C_CLOCK_HZ;
 extern const TSpnInfo KNOWN_SPNS[20];
 extern const uint8_t KNOWN_SPN_COUNT;
 
@@ -0,0 +1,44 @@
+#ifndef ADS1115DRIVER_H
+#define ADS1115DRIVER_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../AppConfig.h"
+#include "I2cBus.h"
+#include <Display/ByteUtils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern const uint8_t ADS1115Driver_GAIN_MAX;
+
+/* Function prototypes */
+bool ADS1115Driver_begin(uint8_t device);
+uint8_t ADS1115Driver_submitRdyThreshold(uint8_t device, bool high);
+void ADS1115Driver_resetChannels(uint8_t device);
+void ADS1115Driver_setDataRate(uint8_t device, uint8_t channel, uint8_t rate);
+uint16_t ADS1115Driver_getDataRateSps(uint8_t device, uint8_t channel);
+uint32_t ADS1115Driver_conversionTimeoutMs(uint8_t device, uint8_t channel);
+void ADS1115Driver_setGain(uint8_t device, uint8_t channel, uint8_t gain);
+uint8_t ADS1115Driver_getGain(uint8_t device, uint8_t channel);
+uint8_t ADS1115Driver_startSingle(uint8_t device, uint8_t channel);
+uint8_t ADS1115Driver_startContinuous(uint8_t device, uint8_t channel);
+uint8_t ADS1115Driver_requestResult(uint8_t device);
+void ADS1115Driver_invalidatePointer(uint8_t device);
+int16_t ADS1115Driver_getResult(uint8_t handle);
+float ADS1115Driver_toVolts(uint8_t gain, int16_t raw);
+int32_t ADS1115Driver_toNormalized(uint8_t gain, int16_t raw);
+float ADS1115Driver_normalizedToVolts(float counts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115DRIVER_H */
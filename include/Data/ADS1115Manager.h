@@ -10,7 +10,9 @@
 #include <stdbool.h>
 #include "../AppConfig.h"
 #include "types/TAdcReading.h"
-#include <Display/HardwareMap.h>
+#include "types/EAdcHealth.h"
+#include "I2cBus.h"
+#include "ADS1115Driver.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,12 +22,36 @@ extern "C" {
 typedef struct AppConfig AppConfig;
 typedef struct TAdcReading TAdcReading;
 
+/* Struct definitions */
+typedef struct TWindowAverage {
+    int32_t counts;
+    uint32_t spanUs;
+} TWindowAverage;
+
 /* Function prototypes */
 void ADS1115Manager_initialize(const AppConfig& config);
 bool ADS1115Manager_update(void);
 TAdcReading ADS1115Manager_getReading(uint8_t device, uint8_t channel);
 float ADS1115Manager_getVoltage(uint8_t device, uint8_t channel);
+float ADS1115Manager_getMeanVoltage(uint8_t device, uint8_t channel);
+float ADS1115Manager_getDecimatedVoltage(uint8_t device, uint8_t channel);
+int32_t ADS1115Manager_getDecimatedCounts(uint8_t device, uint8_t channel);
+uint32_t ADS1115Manager_getDecimatedTimestamp(uint8_t device, uint8_t channel);
+bool ADS1115Manager_isDecimatedValid(uint8_t device, uint8_t channel);
+uint32_t ADS1115Manager_getHistorySpanUs(uint8_t device, uint8_t channel);
+TWindowAverage ADS1115Manager_getWindowCounts(uint8_t device, uint8_t channel, uint32_t windowUs);
+uint32_t ADS1115Manager_getDecimatedSeq(uint8_t device, uint8_t channel);
+void ADS1115Manager_setDecimation(uint8_t device, uint8_t channel, uint8_t factor);
+uint8_t ADS1115Manager_getHistoryCount(uint8_t device, uint8_t channel);
+float ADS1115Manager_getHistoryVoltage(uint8_t device, uint8_t channel, uint8_t age);
+uint32_t ADS1115Manager_getHistoryTimestamp(uint8_t device, uint8_t channel, uint8_t age);
+float ADS1115Manager_getSampleRate(uint8_t device, uint8_t channel);
 bool ADS1115Manager_isDeviceEnabled(uint8_t device);
+EAdcHealth ADS1115Manager_getHealth(uint8_t device);
+uint32_t ADS1115Manager_getTimeoutCount(uint8_t device);
+uint32_t ADS1115Manager_getErrorCount(uint8_t device);
+uint32_t ADS1115Manager_getRecoveryCount(uint8_t device);
+uint32_t ADS1115Manager_getReinitCount(uint8_t device);
 void ADS1115Manager_printDebugInfo(void);
 
 #ifdef __cplusplus
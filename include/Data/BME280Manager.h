@@ -9,6 +9,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <AppConfig.h>
+#include "I2cBus.h"
+#include <Display/ByteUtils.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,6 +26,8 @@ float BME280Manager_getTemperatureC(void);
 float BME280Manager_getHumidity(void);
 float BME280Manager_getPressurekPa(void);
 bool BME280Manager_isEnabled(void);
+uint32_t BME280Manager_getErrorCount(void);
+void BME280Manager_printDebugInfo(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,30 @@
+#ifndef DERIVEDCONFIG_H
+#define DERIVEDCONFIG_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "types/EValueId.h"
+#include "types/EDerivedOp.h"
+#include "types/TDerivedConfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct TDerivedConfig TDerivedConfig;
+
+/* External variables */
+extern const TDerivedConfig DERIVED_CONFIGS[4];
+extern const uint8_t DERIVED_CONFIG_COUNT;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DERIVEDCONFIG_H */
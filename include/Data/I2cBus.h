@@ -0,0 +1,42 @@
+#ifndef I2CBUS_H
+#define I2CBUS_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "types/EI2cStatus.h"
+#include <Display/ByteUtils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External variables */
+extern const uint8_t I2C_NO_HANDLE;
+
+/* Function prototypes */
+void I2cBus_initialize(void);
+uint8_t I2cBus_submitWrite(uint8_t address, uint8_t reg, uint16_t value);
+uint8_t I2cBus_submitRead(uint8_t address, uint8_t reg, uint8_t length);
+uint8_t I2cBus_submitReadCurrent(uint8_t address, uint8_t length);
+EI2cStatus I2cBus_getStatus(uint8_t handle);
+uint8_t I2cBus_getByte(uint8_t handle, uint8_t index);
+void I2cBus_release(uint8_t handle);
+void I2cBus_service(void);
+void I2cBus_setClock(uint32_t hz);
+bool I2cBus_clearBus(void);
+uint32_t I2cBus_getBusClearCount(void);
+void I2cBus_flush(void);
+EI2cStatus I2cBus_writeBlocking(uint8_t address, uint8_t reg, uint16_t value);
+EI2cStatus I2cBus_readBlocking(uint8_t address, uint8_t reg, uint8_t length, uint8_t data[8]);
+void I2cBus_printDebugInfo(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I2CBUS_H */
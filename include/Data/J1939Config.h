@@ -21,9 +21,9 @@ typedef struct TSpnConfig TSpnConfig;
 typedef struct TPgnConfig TPgnConfig;
 
 /* External variables */
-extern const TSpnConfig SPN_CONFIGS[20];
+extern const TSpnConfig SPN_CONFIGS[24];
 extern const uint8_t SPN_CONFIG_COUNT;
-extern const TPgnConfig PGN_CONFIGS[8];
+extern const TPgnConfig PGN_CONFIGS[9];
 extern const uint8_t PGN_CONFIG_COUNT;
 
 /* Function prototypes */
@@ -26,6 +26,7 @@ void MAX31856Manager_initialize(const AppConfig& config);
 bool MAX31856Manager_update(void);
 float MAX31856Manager_getTemperatureC(void);
 float MAX31856Manager_getColdJunctionC(void);
+uint32_t MAX31856Manager_getReadingTimestamp(void);
 bool MAX31856Manager_isEnabled(void);
 uint8_t MAX31856Manager_getFaultStatus(void);
 
@@ -18,6 +18,9 @@ extern "C" {
 typedef struct TSensorValue {
     float value;
     bool hasHardware;
+    int32_t fixedValue;
+    bool fixedValid;
+    bool valid;
 } TSensorValue;
 
 /* External variables */
@@ -0,0 +1,29 @@
+#ifndef EADCHEALTH_H
+#define EADCHEALTH_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Enumerations */
+typedef enum {
+    EAdcHealth_ADC_UNUSED = 0,
+    EAdcHealth_ADC_HEALTHY = 1,
+    EAdcHealth_ADC_BACKOFF = 2,
+    EAdcHealth_ADC_PROBING = 3,
+    EAdcHealth_ADC_QUARANTINED = 4
+} EAdcHealth;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EADCHEALTH_H */
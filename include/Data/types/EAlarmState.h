@@ -0,0 +1,27 @@
+#ifndef EALARMSTATE_H
+#define EALARMSTATE_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Enumerations */
+typedef enum {
+    EAlarmState_ALARM_NORMAL = 0,
+    EAlarmState_ALARM_LOW = 1,
+    EAlarmState_ALARM_HIGH = 2
+} EAlarmState;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EALARMSTATE_H */
@@ -0,0 +1,27 @@
+#ifndef EDERIVEDOP_H
+#define EDERIVEDOP_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Enumerations */
+typedef enum {
+    EDerivedOp_DERIVED_DIFF = 0,
+    EDerivedOp_DERIVED_RATIO = 1,
+    EDerivedOp_DERIVED_EFFECTIVENESS = 2
+} EDerivedOp;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EDERIVEDOP_H */
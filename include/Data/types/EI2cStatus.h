@@ -0,0 +1,32 @@
+#ifndef EI2CSTATUS_H
+#define EI2CSTATUS_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Enumerations */
+typedef enum {
+    EI2cStatus_I2C_FREE = 0,
+    EI2cStatus_I2C_PENDING = 1,
+    EI2cStatus_I2C_ACTIVE = 2,
+    EI2cStatus_I2C_DONE = 3,
+    EI2cStatus_I2C_NACK = 4,
+    EI2cStatus_I2C_TIMEOUT = 5,
+    EI2cStatus_I2C_ARB_LOST = 6,
+    EI2cStatus_I2C_BUS_ERROR = 7
+} EI2cStatus;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EI2CSTATUS_H */
@@ -36,7 +36,11 @@ typedef enum {
     EValueId_FUEL_PRES = 18,
     EValueId_FUEL_TEMP = 19,
     EValueId_ENGINE_BAY_TEMP = 20,
-    EValueId_VALUE_ID_COUNT = 21,
+    EValueId_BOOST_PRES = 21,
+    EValueId_TURBO1_COMP_PRES_RATIO = 22,
+    EValueId_CAC1_EFFICIENCY = 23,
+    EValueId_OIL_COOLANT_TEMP_DELTA = 24,
+    EValueId_VALUE_ID_COUNT = 25,
     EValueId_VALUE_UNASSIGNED = 255
 } EValueId;
 
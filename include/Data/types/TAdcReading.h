@@ -17,6 +17,7 @@ extern "C" {
 typedef struct TAdcReading {
     int16_t rawValue;
     uint32_t timestamp;
+    uint8_t gain;
     bool valid;
 } TAdcReading;
 
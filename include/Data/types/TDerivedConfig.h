@@ -0,0 +1,31 @@
+#ifndef TDERIVEDCONFIG_H
+#define TDERIVEDCONFIG_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "EValueId.h"
+#include "EDerivedOp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Struct definitions */
+typedef struct TDerivedConfig {
+    EValueId dest;
+    EDerivedOp op;
+    EValueId a;
+    EValueId b;
+    EValueId c;
+} TDerivedConfig;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TDERIVEDCONFIG_H */
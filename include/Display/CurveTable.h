@@ -0,0 +1,36 @@
+#ifndef CURVETABLE_H
+#define CURVETABLE_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../AppConfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct TCurveConfig TCurveConfig;
+
+/* Struct definitions */
+typedef struct TCurveTable {
+    uint8_t count;
+    int32_t counts[32];
+    int32_t valuesQ10[32];
+} TCurveTable;
+
+/* Function prototypes */
+bool CurveTable_isValid(const TCurveConfig& curve);
+void CurveTable_build(TCurveTable& table, const TCurveConfig& curve);
+int32_t CurveTable_lookup(int32_t counts, const TCurveTable& table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CURVETABLE_H */
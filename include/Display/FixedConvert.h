@@ -0,0 +1,43 @@
+#ifndef FIXEDCONVERT_H
+#define FIXEDCONVERT_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../AppConfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct TPressureInputConfig TPressureInputConfig;
+
+/* Struct definitions */
+typedef struct TPressureFixed {
+    uint32_t zeroCounts;
+    uint32_t ceilingCounts;
+    uint32_t multiplier;
+    bool gauge;
+    int32_t spanQ10;
+    int32_t interceptQ10;
+    int32_t fullScaleQ10;
+} TPressureFixed;
+
+/* Function prototypes */
+TPressureFixed FixedConvert_pressureCoeffs(const TPressureInputConfig& cfg);
+void FixedConvert_applyAtmospheric(TPressureFixed& coeffs, int32_t atmosphericQ10);
+int32_t FixedConvert_pressure(int32_t counts, const TPressureFixed& coeffs);
+void FixedConvert_pressureBatch(uint8_t count, const uint8_t slots[7], const int32_t counts[7], const uint32_t multiplier[7], const int32_t intercept[7], const int32_t fullScale[7], int32_t result[7]);
+int32_t FixedConvert_fromFloat(float value);
+float FixedConvert_toFloat(int32_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FIXEDCONVERT_H */
@@ -17,6 +17,17 @@ extern "C" {
 extern const uint8_t InputValid_TEMP_COUNT;
 extern const uint8_t InputValid_PRESSURE_COUNT;
 extern const uint8_t InputValid_NTC_PARAM_COUNT;
+extern const uint8_t InputValid_CURVE_COUNT;
+extern const uint8_t InputValid_CURVE_POINT_COUNT;
+extern const uint8_t InputValid_STATS_COUNT;
+extern const uint16_t InputValid_STATS_WINDOW_MAX;
+extern const uint8_t InputValid_CYLINDER_MAX;
+extern const uint8_t InputValid_PULSATION_WINDOW_MAX;
+extern const uint8_t InputValid_ALARM_COUNT;
+extern const uint16_t InputValid_ALARM_DEBOUNCE_MAX_MS;
+extern const uint8_t InputValid_PROCESS_GROUP_COUNT;
+extern const uint16_t InputValid_PROCESS_PERIOD_MIN_MS;
+extern const uint16_t InputValid_PROCESS_PERIOD_MAX_MS;
 
 /* Function prototypes */
 bool InputValid_isValidTempInput(uint8_t input);
@@ -33,6 +44,22 @@ bool InputValid_isValidSubQuery(uint8_t subQuery);
 bool InputValid_isValidJ1939Address(uint8_t address);
 bool InputValid_isValidAdsDevice(uint8_t device);
 bool InputValid_isValidAdsChannel(uint8_t channel);
+bool InputValid_isValidSamplePriority(uint8_t priority);
+bool InputValid_isValidAdsDataRate(uint8_t rate);
+bool InputValid_isValidFilterType(uint8_t filterType);
+bool InputValid_isValidMedianWindow(uint8_t window);
+bool InputValid_isValidCurve(uint8_t curve);
+bool InputValid_isValidCurvePoint(uint8_t point);
+bool InputValid_isValidStatsSlot(uint8_t slot);
+bool InputValid_isValidStatsWindow(uint16_t windowSec);
+bool InputValid_isValidHoldMode(uint8_t holdMode);
+bool InputValid_isValidCylinderCount(uint8_t cylinders);
+bool InputValid_isValidPulsationWindow(uint8_t windowMs);
+bool InputValid_isValidAlarmSlot(uint8_t slot);
+bool InputValid_isValidAlarmLimits(int16_t lowTenths, int16_t highTenths, uint16_t hysteresisTenths);
+bool InputValid_isValidAlarmDebounce(uint16_t debounceMs);
+bool InputValid_isValidProcessGroup(uint8_t group);
+bool InputValid_isValidProcessPeriod(uint16_t periodMs);
 
 #ifdef __cplusplus
 }
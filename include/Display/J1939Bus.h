@@ -10,8 +10,10 @@
 #include <stdbool.h>
 #include <AppConfig.h>
 #include "J1939Encode.h"
+#include "FixedConvert.h"
 #include <Data/J1939Config.h>
 #include <Data/SensorValues.h>
+#include "SpnHold.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,8 +22,12 @@ extern "C" {
 /* Function prototypes */
 void J1939Bus_sendMessage(uint16_t pgn, const uint8_t buf[8]);
 void J1939Bus_sendPgnGeneric(uint16_t pgn);
+void J1939Bus_sendPgnKeepHold(uint16_t pgn);
 bool J1939Bus_hasPendingCommand(void);
 void J1939Bus_getPendingCommand(uint8_t outData[8]);
+uint32_t J1939Bus_getRxLatencyMaxUs(void);
+void J1939Bus_resetRxLatencyMax(void);
+float J1939Bus_getEngineRpm(void);
 void J1939Bus_initialize(void);
 
 #ifdef __cplusplus
@@ -13,8 +13,13 @@
 extern "C" {
 #endif
 
+/* External variables */
+extern const uint8_t J1939Encode_FIXED_SHIFT_NONE;
+
 /* Function prototypes */
 uint16_t J1939Encode_encode(float value, float resolution, float offset);
+uint8_t J1939Encode_fixedShift(float resolution);
+uint16_t J1939Encode_encodeFixed(int32_t valueQ10, int32_t offsetQ10, uint8_t shift);
 uint16_t J1939Encode_temp16bit(float temperatureC);
 uint8_t J1939Encode_temp8bit(float temperatureC);
 uint8_t J1939Encode_humidity(float humidityPercent);
@@ -0,0 +1,37 @@
+#ifndef NTCTABLE_H
+#define NTCTABLE_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../AppConfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct TTempInputConfig TTempInputConfig;
+
+/* Struct definitions */
+typedef struct TNtcTable {
+    int32_t counts[129];
+} TNtcTable;
+
+/* External variables */
+extern const int32_t NtcTable_ERROR_Q10;
+
+/* Function prototypes */
+void NtcTable_build(TNtcTable& table, const TTempInputConfig& cfg);
+int32_t NtcTable_lookup(int32_t counts, const TNtcTable& table);
+void NtcTable_lookupBatch(uint8_t count, const uint8_t slots[8], const int32_t counts[8], const TNtcTable tables[8], int32_t result[8]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NTCTABLE_H */
@@ -0,0 +1,33 @@
+#ifndef SPNHOLD_H
+#define SPNHOLD_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <AppConfig.h>
+#include <Data/J1939Config.h>
+#include <Data/SensorValues.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct AppConfig AppConfig;
+
+/* Function prototypes */
+void SpnHold_configure(const AppConfig& config);
+uint8_t SpnHold_select(AppConfig& config, EValueId id, uint16_t spn, ESpnHold hold);
+void SpnHold_capture(EValueId id, bool valid);
+void SpnHold_take(uint8_t index, TSensorValue& sample);
+void SpnHold_peek(uint8_t index, TSensorValue& sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPNHOLD_H */
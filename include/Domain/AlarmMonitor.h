@@ -0,0 +1,53 @@
+#ifndef ALARMMONITOR_H
+#define ALARMMONITOR_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <AppConfig.h>
+#include <Data/J1939Config.h>
+#include <Data/types/EAlarmState.h>
+#include <Display/J1939Bus.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct AppConfig AppConfig;
+
+/* Struct definitions */
+typedef struct TAlarmSlot {
+    uint8_t valueId;
+    bool lowEnabled;
+    bool highEnabled;
+    float low;
+    float high;
+    float hysteresis;
+    uint32_t debounceUs;
+    uint16_t pgnMask;
+    EAlarmState state;
+    EAlarmState candidate;
+    uint32_t candidateSinceUs;
+    bool eventPending;
+    float eventValue;
+    uint32_t eventUs;
+} TAlarmSlot;
+
+/* Function prototypes */
+void AlarmMonitor_configure(const AppConfig& config);
+void AlarmMonitor_check(EValueId id, float value, bool valid, uint32_t timestampUs);
+void AlarmMonitor_flush(void);
+EAlarmState AlarmMonitor_getState(uint8_t slot);
+uint32_t AlarmMonitor_getLatencyMaxUs(void);
+void AlarmMonitor_resetLatencyMax(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ALARMMONITOR_H */
@@ -11,6 +11,14 @@
 #include <AppConfig.h>
 #include <Data/ConfigStorage.h>
 #include <Domain/Hardware.h>
+#include <Domain/SensorProcessor.h>
+#include <Domain/GlitchFilter.h>
+#include <Domain/SignalFilter.h>
+#include <Domain/DerivedValues.h>
+#include <Domain/RollingStats.h>
+#include <Domain/AlarmMonitor.h>
+#include <Display/SpnHold.h>
+#include <Display/CurveTable.h>
 #include <Display/Presets.h>
 #include <Display/InputValid.h>
 
@@ -28,7 +36,17 @@ typedef enum {
     ECommandResult_CMD_INVALID_SENSOR_NUMBER = 5,
     ECommandResult_CMD_INVALID_TC_TYPE = 6,
     ECommandResult_CMD_INVALID_PRESET = 7,
-    ECommandResult_CMD_INVALID_NTC_PARAM = 8
+    ECommandResult_CMD_INVALID_NTC_PARAM = 8,
+    ECommandResult_CMD_INVALID_PRIORITY = 9,
+    ECommandResult_CMD_INVALID_DATA_RATE = 10,
+    ECommandResult_CMD_INVALID_FILTER = 11,
+    ECommandResult_CMD_INVALID_MEDIAN_WINDOW = 12,
+    ECommandResult_CMD_INVALID_CURVE = 13,
+    ECommandResult_CMD_INVALID_STATS = 14,
+    ECommandResult_CMD_INVALID_HOLD = 15,
+    ECommandResult_CMD_INVALID_PULSATION = 16,
+    ECommandResult_CMD_INVALID_ALARM = 17,
+    ECommandResult_CMD_INVALID_CADENCE = 18
 } ECommandResult;
 typedef enum {
     EValueCategory_VALUE_CAT_TEMPERATURE = 0,
@@ -0,0 +1,31 @@
+#ifndef DERIVEDVALUES_H
+#define DERIVEDVALUES_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <Data/SensorValues.h>
+#include <Data/DerivedConfig.h>
+#include <Domain/RollingStats.h>
+#include <Display/SpnHold.h>
+#include <Domain/AlarmMonitor.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Function prototypes */
+bool DerivedValues_isDerived(EValueId id);
+void DerivedValues_markChanged(EValueId id);
+void DerivedValues_refreshAvailability(void);
+void DerivedValues_update(uint32_t timestampUs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DERIVEDVALUES_H */
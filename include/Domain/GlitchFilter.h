@@ -0,0 +1,40 @@
+#ifndef GLITCHFILTER_H
+#define GLITCHFILTER_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <AppConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct AppConfig AppConfig;
+
+/* Struct definitions */
+typedef struct TGlitchState {
+    float window[5];
+    uint8_t head;
+    float lastOutput;
+    uint32_t lastTimestampUs;
+    bool primed;
+} TGlitchState;
+
+/* Function prototypes */
+void GlitchFilter_configure(const AppConfig& config);
+bool GlitchFilter_isActive(EValueId id);
+void GlitchFilter_reset(EValueId id);
+float GlitchFilter_apply(EValueId id, float sample, uint32_t timestampUs);
+uint32_t GlitchFilter_getRejectCount(EValueId id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLITCHFILTER_H */
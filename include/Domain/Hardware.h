@@ -9,10 +9,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <AppConfig.h>
+#include <Data/I2cBus.h>
 #include <Data/ADS1115Manager.h>
 #include <Data/MAX31856Manager.h>
 #include <Data/BME280Manager.h>
 #include <Data/SensorValues.h>
+#include "SensorProcessor.h"
+#include "DerivedValues.h"
+#include "AlarmMonitor.h"
 
 #ifdef __cplusplus
 extern "C" {
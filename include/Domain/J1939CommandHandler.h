@@ -12,6 +12,7 @@
 #include <Display/J1939Bus.h>
 #include <Domain/CommandHandler.h>
 #include <Display/FloatBytes.h>
+#include <Domain/RollingStats.h>
 
 #ifdef __cplusplus
 extern "C" {
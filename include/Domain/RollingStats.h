@@ -0,0 +1,56 @@
+#ifndef ROLLINGSTATS_H
+#define ROLLINGSTATS_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include <AppConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct AppConfig AppConfig;
+
+/* Struct definitions */
+typedef struct TStatsWindow {
+    float samples[256];
+    uint32_t timestamps[256];
+    uint8_t minQueue[256];
+    uint8_t maxQueue[256];
+    uint16_t head;
+    uint16_t count;
+    uint16_t minFront;
+    uint16_t minCount;
+    uint16_t maxFront;
+    uint16_t maxCount;
+    float mean;
+    float m2;
+    int32_t windowUs;
+    uint32_t spacingUs;
+    uint32_t lastAcceptedUs;
+} TStatsWindow;
+typedef struct TRollingStats {
+    float minimum;
+    float maximum;
+    float mean;
+    float stddev;
+    uint16_t count;
+} TRollingStats;
+
+/* Function prototypes */
+void RollingStats_configure(const AppConfig& config);
+void RollingStats_add(EValueId id, float value, uint32_t timestampUs);
+bool RollingStats_get(uint8_t slot, uint32_t nowUs, TRollingStats& result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROLLINGSTATS_H */
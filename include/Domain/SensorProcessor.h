@@ -9,19 +9,36 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <AppConfig.h>
+#include <Data/I2cBus.h>
 #include <Data/ADS1115Manager.h>
 #include <Data/MAX31856Manager.h>
 #include <Data/BME280Manager.h>
 #include <Display/SensorConvert.h>
+#include <Display/FixedConvert.h>
+#include <Display/NtcTable.h>
+#include <Display/CurveTable.h>
 #include <Display/HardwareMap.h>
 #include <Data/SensorValues.h>
+#include <Domain/GlitchFilter.h>
+#include <Domain/SignalFilter.h>
+#include <Domain/DerivedValues.h>
+#include <Domain/RollingStats.h>
+#include <Display/SpnHold.h>
+#include <Display/J1939Bus.h>
+#include <Domain/AlarmMonitor.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* External type dependencies - include appropriate headers */
+typedef struct AppConfig AppConfig;
+
 /* Function prototypes */
+void SensorProcessor_reloadCalibration(const AppConfig& config);
+uint32_t SensorProcessor_getPulsationSpanUs(EValueId val);
 void SensorProcessor_initialize(void);
+void SensorProcessor_acquire(void);
 void SensorProcessor_update(void);
 
 #ifdef __cplusplus
@@ -12,9 +12,16 @@
 #include <Domain/CommandHandler.h>
 #include <Display/FaultDecode.h>
 #include <Data/ADS1115Manager.h>
+#include <Data/BME280Manager.h>
+#include <Data/I2cBus.h>
 #include <Data/MAX31856Manager.h>
 #include <Data/SensorValues.h>
+#include <Data/J1939Config.h>
+#include <Display/J1939Bus.h>
 #include <Display/ValueName.h>
+#include <Domain/GlitchFilter.h>
+#include <Domain/RollingStats.h>
+#include <Domain/AlarmMonitor.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -0,0 +1,38 @@
+#ifndef SIGNALFILTER_H
+#define SIGNALFILTER_H
+
+/**
+ * Generated by C-Next Transpiler
+ * Header file for cross-language interoperability
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <AppConfig.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* External type dependencies - include appropriate headers */
+typedef struct AppConfig AppConfig;
+
+/* Struct definitions */
+typedef struct TFilterState {
+    float stage1;
+    float stage2;
+    uint32_t lastTimestampUs;
+    bool primed;
+} TFilterState;
+
+/* Function prototypes */
+void SignalFilter_configure(const AppConfig& config);
+bool SignalFilter_isActive(EValueId id);
+void SignalFilter_reset(EValueId id);
+float SignalFilter_apply(EValueId id, float sample, uint32_t timestampUs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIGNALFILTER_H */
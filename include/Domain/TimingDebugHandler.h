@@ -9,6 +9,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <AppConfig.h>
+#include <Display/J1939Bus.h>
+#include <Domain/AlarmMonitor.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -13,9 +13,9 @@
 extern const uint32_t CONFIG_MAGIC = 0x4F53534D;
 
 // "OSSM" in ASCII
-extern const uint8_t CONFIG_VERSION = 4;
+extern const uint8_t CONFIG_VERSION = 14;
 
-// EValueId-based config (was SPN-based)
+// Per-group processing cadence (v13: threshold alarms)
 // Number of user-facing inputs
 extern const uint8_t TEMP_INPUT_COUNT = 8;
 
@@ -24,6 +24,64 @@ extern const uint8_t PRESSURE_INPUT_COUNT = 7;
 // ADS1115 device count (internal, fixed)
 extern const uint8_t ADS_DEVICE_COUNT = 4;
 
+// ADS1115 data rate codes (config register DR field), index = code
+extern const uint8_t ADS_DATA_RATE_COUNT = 8;
+
+extern const uint16_t ADS_DATA_RATE_SPS[8] = {8, 16, 32, 64, 128, 250, 475, 860};
+
+// Sampling priority: relative weight in the per-device ADC scheduler
+extern const uint8_t SAMPLE_PRIORITY_MAX = 8;
+
+// Sampling defaults - NTCs change slowly, pressures need bandwidth
+extern const uint8_t DEFAULT_TEMP_PRIORITY = 1;
+
+extern const uint8_t DEFAULT_TEMP_DATA_RATE = 2;
+
+// 32 SPS
+extern const uint8_t DEFAULT_PRESSURE_PRIORITY = 4;
+
+extern const uint8_t DEFAULT_PRESSURE_DATA_RATE = 7;
+
+// 860 SPS
+// User calibration curves (voltage -> value breakpoint tables)
+extern const uint8_t CURVE_SLOT_COUNT = 2;
+
+extern const uint8_t CURVE_POINT_MAX = 32;
+
+// Rolling min/max/mean/stddev windows
+extern const uint8_t STATS_SLOT_COUNT = 4;
+
+// Peak/valley hold mode per SPN_CONFIGS entry
+extern const uint8_t SPN_HOLD_COUNT = 24;
+
+// Must match SPN_CONFIG_COUNT
+// Engine-synchronous pressure averaging defaults
+extern const uint8_t DEFAULT_PULSATION_CYLINDERS = 6;
+
+extern const uint8_t DEFAULT_PULSATION_WINDOW_MS = 20;
+
+// Local threshold alarms
+extern const uint8_t ALARM_SLOT_COUNT = 8;
+
+extern const int16_t ALARM_NO_LOW = -32768;
+
+// lowTenths value disabling the low limit
+extern const int16_t ALARM_NO_HIGH = 32767;
+
+// highTenths value disabling the high limit
+// Processing period per value group
+extern const uint8_t PROCESS_GROUP_COUNT = 4;
+
+extern const uint16_t DEFAULT_PROCESS_PERIOD_MS = 50;
+
+// Value groups processed on their own period
+typedef enum {
+    EProcessGroup_PROCESS_PRESSURE = 0,
+    EProcessGroup_PROCESS_TEMPERATURE = 1,
+    EProcessGroup_PROCESS_EGT = 2,
+    EProcessGroup_PROCESS_BME280 = 3
+} EProcessGroup;
+
 // Thermocouple types (MAX31856)
 typedef enum {
     EThermocoupleType_TC_TYPE_B = 0,
@@ -81,6 +139,20 @@ typedef enum {
     EPressurePreset_PRESSURE_PRESET_500_PSIG = 30
 } EPressurePreset;
 
+// Per-value smoothing filter (SignalFilter)
+typedef enum {
+    EFilterType_FILTER_NONE = 0,
+    EFilterType_FILTER_EMA = 1,
+    EFilterType_FILTER_IIR2 = 2
+} EFilterType;
+
+// What an SPN reports between broadcasts (SpnHold)
+typedef enum {
+    ESpnHold_SPN_HOLD_LATEST = 0,
+    ESpnHold_SPN_HOLD_MAX = 1,
+    ESpnHold_SPN_HOLD_MIN = 2
+} ESpnHold;
+
 // Known SPNs and their categories
 typedef enum {
     ESpnCategory_SPN_CAT_TEMPERATURE = 0,
@@ -97,6 +169,9 @@ typedef struct TTempInputConfig {
     float coeffB;
     float coeffC;
     float resistorValue;
+    uint8_t samplePriority;
+    uint8_t dataRate;
+    uint8_t sampleReserved[2];
 } TTempInputConfig;
 
 // Pressure input configuration (pres1-pres7)
@@ -104,9 +179,63 @@ typedef struct TPressureInputConfig {
     EValueId assignedValue;
     uint16_t maxPressure;
     EPressureType pressureType;
-    uint8_t reserved;
+    uint8_t samplePriority;
+    uint8_t dataRate;
 } TPressureInputConfig;
 
+// Filter applied to one EValueId before it is published
+typedef struct TValueFilterConfig {
+    EFilterType filterType;
+    uint16_t timeConstantMs;
+} TValueFilterConfig;
+
+// Spike rejection applied to one EValueId ahead of its filter
+typedef struct TValueGlitchConfig {
+    uint8_t medianWindow;
+    uint8_t glitchReserved;
+    uint16_t maxRatePerSec;
+} TValueGlitchConfig;
+
+// One curve breakpoint: input voltage -> value
+typedef struct TCurvePoint {
+    uint16_t millivolts;
+    int16_t valueTenths;
+} TCurvePoint;
+
+// Calibration curve replacing an input's built-in conversion
+typedef struct TCurveConfig {
+    uint8_t inputType;
+    uint8_t input;
+    uint8_t pointCount;
+    uint8_t curveReserved;
+    TCurvePoint points[32];
+} TCurveConfig;
+
+// Rolling statistics window on one value
+typedef struct TStatsConfig {
+    uint8_t valueId;
+    uint8_t statsReserved;
+    uint16_t windowSec;
+} TStatsConfig;
+
+// Pressure inputs averaged over whole engine firing periods
+typedef struct TPulsationConfig {
+    uint8_t inputMask;
+    uint8_t cylinders;
+    uint8_t windowMs;
+    uint8_t pulsationReserved;
+} TPulsationConfig;
+
+// Threshold alarm on one value
+typedef struct TAlarmConfig {
+    uint8_t valueId;
+    uint8_t alarmReserved;
+    int16_t lowTenths;
+    int16_t highTenths;
+    uint16_t hysteresisTenths;
+    uint16_t debounceMs;
+} TAlarmConfig;
+
 // Fixed hardware mapping: tempX -> ADS device/channel
 // This is internal, not user-configurable
 typedef struct THardwareMapping {
@@ -134,6 +263,14 @@ typedef struct AppConfig {
     uint8_t tcReserved[2];
     bool bme280Enabled;
     uint8_t bme280Reserved[3];
+    TValueFilterConfig valueFilters[EValueId_VALUE_ID_COUNT];
+    TValueGlitchConfig valueGlitch[EValueId_VALUE_ID_COUNT];
+    TCurveConfig curves[2];
+    TStatsConfig stats[4];
+    uint8_t spnHold[24];
+    TPulsationConfig pulsation;
+    TAlarmConfig alarms[8];
+    uint16_t processPeriodMs[4];
     uint32_t checksum;
 } AppConfig;
 
@@ -181,6 +318,10 @@ extern const uint8_t ADS_I2C_ADDRESSES[4] = {0x48, 0x49, 0x4A, 0x4B};
 // ADS1115 DRDY pins (fixed)
 extern const uint8_t ADS_DRDY_PINS[4] = {0, 1, 4, 5};
 
+// Sensor I2C bus clock - ADS1115 and BME280 are both Fast-mode (400kHz) parts.
+// Only raise toward 1MHz (Fm+) on boards with stiff pull-ups and short wiring.
+extern const uint32_t SENSOR_I2C_CLOCK_HZ = 400000;
+
 // D0, D1, D4, D5
 // Known SPNs lookup table
 extern const TSpnInfo KNOWN_SPNS[20] = {(TSpnInfo){ .spn = 175, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 110, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 1637 }, (TSpnInfo){ .spn = 174, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 105, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 1363 }, (TSpnInfo){ .spn = 1131, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 1132, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 1133, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 172, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 441, .category = ESpnCategory_SPN_CAT_TEMPERATURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 100, .category = ESpnCategory_SPN_CAT_PRESSURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 109, .category = ESpnCategory_SPN_CAT_PRESSURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 94, .category = ESpnCategory_SPN_CAT_PRESSURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 102, .category = ESpnCategory_SPN_CAT_PRESSURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 106, .category = ESpnCategory_SPN_CAT_PRESSURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 1127, .category = ESpnCategory_SPN_CAT_PRESSURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 1128, .category = ESpnCategory_SPN_CAT_PRESSURE, .hiResSpn = 0 }, (TSpnInfo){ .spn = 173, .category = ESpnCategory_SPN_CAT_EGT, .hiResSpn = 0 }, (TSpnInfo){ .spn = 171, .category = ESpnCategory_SPN_CAT_BME280, .hiResSpn = 0 }, (TSpnInfo){ .spn = 108, .category = ESpnCategory_SPN_CAT_BME280, .hiResSpn = 0 }, (TSpnInfo){ .spn = 354, .category = ESpnCategory_SPN_CAT_BME280, .hiResSpn = 0 }};
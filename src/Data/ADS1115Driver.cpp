@@ -0,0 +1,172 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "ADS1115Driver.h"
+
+/**
+ * ADS1115 register-level driver
+ * Talks to the ADCs through I2cBus using cached config words, so starting a
+ * conversion is one 16-bit write and scaling a result is one table lookup
+ * and one multiply.
+ */
+#include <Arduino.h>
+#include "../AppConfig.h"
+#include "I2cBus.h"
+#include <Display/ByteUtils.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Scope: ADS1115Driver */
+const uint8_t ADS1115Driver_GAIN_MAX = 5;
+static const uint16_t ADS1115Driver_CONFIG_MUX_SINGLE[4] = {0x4000, 0x5000, 0x6000, 0x7000};
+static const float ADS1115Driver_VOLTS_PER_COUNT[6] = {0.0001875, 0.000125, 0.0000625, 0.00003125, 0.000015625, 0.0000078125};
+static const int32_t ADS1115Driver_NORMALIZE_SCALE[6] = {24, 16, 8, 4, 2, 1};
+static uint16_t ADS1115Driver_channelConfig[4][4] = {0};
+static uint8_t ADS1115Driver_channelGain[4][4] = {0};
+static uint8_t ADS1115Driver_channelRate[4][4] = {0};
+static uint8_t ADS1115Driver_pointer[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+
+static uint16_t ADS1115Driver_buildConfig(uint8_t channel, uint8_t gain, uint8_t rate) {
+    return ADS1115Driver_CONFIG_MUX_SINGLE[channel] | (static_cast<uint16_t>(gain) << 9) | (static_cast<uint16_t>(rate) << 5);
+}
+
+bool ADS1115Driver_begin(uint8_t device) {
+    if (device >= ADS_DEVICE_COUNT) {
+        return false;
+    }
+    uint8_t addr = ADS_I2C_ADDRESSES[device];
+    EI2cStatus hiStatus = I2cBus_writeBlocking(addr, 0x03, 0x8000);
+    EI2cStatus loStatus = I2cBus_writeBlocking(addr, 0x02, 0x0000);
+    ADS1115Driver_pointer[device] = 0x02;
+    ADS1115Driver_resetChannels(device);
+    return hiStatus == EI2cStatus_I2C_DONE && loStatus == EI2cStatus_I2C_DONE;
+}
+
+uint8_t ADS1115Driver_submitRdyThreshold(uint8_t device, bool high) {
+    uint8_t reg = 0x02;
+    uint16_t value = 0x0000;
+    if (high) {
+        reg = 0x03;
+        value = 0x8000;
+    }
+    uint8_t handle = I2cBus_submitWrite(ADS_I2C_ADDRESSES[device], reg, value);
+    if (handle != I2C_NO_HANDLE) {
+        ADS1115Driver_pointer[device] = reg;
+    }
+    return handle;
+}
+
+void ADS1115Driver_resetChannels(uint8_t device) {
+    if (device >= ADS_DEVICE_COUNT) {
+        return;
+    }
+    for (uint8_t c = 0; c < 4; c = c + 1) {
+        ADS1115Driver_channelGain[device][c] = 0;
+        ADS1115Driver_channelRate[device][c] = 4;
+        ADS1115Driver_channelConfig[device][c] = ADS1115Driver_buildConfig(c, 0, 4);
+    }
+}
+
+void ADS1115Driver_setDataRate(uint8_t device, uint8_t channel, uint8_t rate) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return;
+    }
+    if (rate >= ADS_DATA_RATE_COUNT) {
+        return;
+    }
+    ADS1115Driver_channelRate[device][channel] = rate;
+    ADS1115Driver_channelConfig[device][channel] = ADS1115Driver_buildConfig(channel, ADS1115Driver_channelGain[device][channel], rate);
+}
+
+void ADS1115Driver_setGain(uint8_t device, uint8_t channel, uint8_t gain) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return;
+    }
+    if (gain > ADS1115Driver_GAIN_MAX) {
+        return;
+    }
+    ADS1115Driver_channelGain[device][channel] = gain;
+    ADS1115Driver_channelConfig[device][channel] = ADS1115Driver_buildConfig(channel, gain, ADS1115Driver_channelRate[device][channel]);
+}
+
+uint8_t ADS1115Driver_getGain(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    return ADS1115Driver_channelGain[device][channel];
+}
+
+uint16_t ADS1115Driver_getDataRateSps(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    return ADS_DATA_RATE_SPS[ADS1115Driver_channelRate[device][channel]];
+}
+
+uint32_t ADS1115Driver_conversionTimeoutMs(uint8_t device, uint8_t channel) {
+    uint32_t sps = ADS1115Driver_getDataRateSps(device, channel);
+    if (sps == 0) {
+        return 0;
+    }
+    return (2000 / sps) + 2;
+}
+
+uint8_t ADS1115Driver_startSingle(uint8_t device, uint8_t channel) {
+    uint16_t config = ADS1115Driver_channelConfig[device][channel] | 0x8000 | 0x0100;
+    uint8_t handle = I2cBus_submitWrite(ADS_I2C_ADDRESSES[device], 0x01, config);
+    if (handle != I2C_NO_HANDLE) {
+        ADS1115Driver_pointer[device] = 0x01;
+    }
+    return handle;
+}
+
+uint8_t ADS1115Driver_startContinuous(uint8_t device, uint8_t channel) {
+    uint8_t handle = I2cBus_submitWrite(ADS_I2C_ADDRESSES[device], 0x01, ADS1115Driver_channelConfig[device][channel]);
+    if (handle != I2C_NO_HANDLE) {
+        ADS1115Driver_pointer[device] = 0x01;
+    }
+    return handle;
+}
+
+uint8_t ADS1115Driver_requestResult(uint8_t device) {
+    uint8_t addr = ADS_I2C_ADDRESSES[device];
+    if (ADS1115Driver_pointer[device] == 0x00) {
+        return I2cBus_submitReadCurrent(addr, 2);
+    }
+    uint8_t handle = I2cBus_submitRead(addr, 0x00, 2);
+    if (handle != I2C_NO_HANDLE) {
+        ADS1115Driver_pointer[device] = 0x00;
+    }
+    return handle;
+}
+
+void ADS1115Driver_invalidatePointer(uint8_t device) {
+    ADS1115Driver_pointer[device] = 0xFF;
+}
+
+int16_t ADS1115Driver_getResult(uint8_t handle) {
+    uint8_t high = I2cBus_getByte(handle, 0);
+    uint8_t low = I2cBus_getByte(handle, 1);
+    return static_cast<int16_t>(ByteUtils_makeU16BE(high, low));
+}
+
+float ADS1115Driver_toVolts(uint8_t gain, int16_t raw) {
+    if (gain > ADS1115Driver_GAIN_MAX) {
+        return 0.0;
+    }
+    return static_cast<float>(raw) * ADS1115Driver_VOLTS_PER_COUNT[gain];
+}
+
+int32_t ADS1115Driver_toNormalized(uint8_t gain, int16_t raw) {
+    if (gain > ADS1115Driver_GAIN_MAX) {
+        return 0;
+    }
+    return static_cast<int32_t>(raw) * ADS1115Driver_NORMALIZE_SCALE[gain];
+}
+
+float ADS1115Driver_normalizedToVolts(float counts) {
+    return counts * ADS1115Driver_VOLTS_PER_COUNT[ADS1115Driver_GAIN_MAX];
+}
@@ -10,146 +10,552 @@
  * Manages multiple ADS1115 devices for sensor readings
  */
 #include <Arduino.h>
-#include <Adafruit_ADS1X15.h>
 #include "../AppConfig.h"
 #include "types/TAdcReading.h"
-#include <Display/HardwareMap.h>
+#include "types/EAdcHealth.h"
+#include "I2cBus.h"
+#include "ADS1115Driver.h"
 
 #include <stdint.h>
 #include <stdbool.h>
 
-// ADR-050: Platform-portable IRQ wrappers for critical sections
-#if defined(__arm__) || defined(__ARM_ARCH)
-// ARM platforms (including ARM Arduino like Teensy 4.x, Due, Zero)
-// Provide inline assembly PRIMASK access to avoid CMSIS header dependencies
-__attribute__((always_inline)) static inline uint32_t __cnx_get_PRIMASK(void) {
-    uint32_t result;
-    __asm volatile ("MRS %0, primask" : "=r" (result));
-    return result;
-}
-__attribute__((always_inline)) static inline void __cnx_set_PRIMASK(uint32_t mask) {
-    __asm volatile ("MSR primask, %0" :: "r" (mask) : "memory");
-}
-#if defined(ARDUINO)
-static inline void __cnx_disable_irq(void) { noInterrupts(); }
-#else
-__attribute__((always_inline)) static inline void __cnx_disable_irq(void) {
-    __asm volatile ("cpsid i" ::: "memory");
-}
-#endif
-#elif defined(__AVR__)
-// AVR Arduino: use SREG for interrupt state
-// Note: Uses PRIMASK naming for API consistency across platforms (AVR has no PRIMASK)
-// Returns uint8_t which is implicitly widened to uint32_t at call sites - this is intentional
-static inline uint8_t __cnx_get_PRIMASK(void) { return SREG; }
-static inline void __cnx_set_PRIMASK(uint8_t mask) { SREG = mask; }
-static inline void __cnx_disable_irq(void) { cli(); }
-#else
-// Fallback: assume CMSIS is available
-static inline void __cnx_disable_irq(void) { __disable_irq(); }
-static inline uint32_t __cnx_get_PRIMASK(void) { return __get_PRIMASK(); }
-static inline void __cnx_set_PRIMASK(uint32_t mask) { __set_PRIMASK(mask); }
-#endif
-
 /* Scope: ADS1115Manager */
-static Adafruit_ADS1115 ADS1115Manager_ads[4] = {};
 static uint8_t ADS1115Manager_drdyPins[4] = {0, 0, 0, 0};
 static bool ADS1115Manager_deviceEnabled[4] = {false, false, false, false};
 static bool ADS1115Manager_deviceInitialized[4] = {false, false, false, false};
 static TAdcReading ADS1115Manager_readings[4][4] = {0};
-static uint8_t ADS1115Manager_currentDevice = 0;
-static uint8_t ADS1115Manager_currentChannel = 0;
-static bool ADS1115Manager_conversionStarted = false;
-static uint32_t ADS1115Manager_conversionStartTime = 0;
-static const uint16_t ADS1115Manager_MUX_SINGLE[4] = {ADS1X15_REG_CONFIG_MUX_SINGLE_0, ADS1X15_REG_CONFIG_MUX_SINGLE_1, ADS1X15_REG_CONFIG_MUX_SINGLE_2, ADS1X15_REG_CONFIG_MUX_SINGLE_3};
-
-static void ADS1115Manager_startConversion(void) {
-    if (ADS1115Manager_currentDevice >= ADS_DEVICE_COUNT || !ADS1115Manager_deviceInitialized[ADS1115Manager_currentDevice]) {
-        ADS1115Manager_conversionStarted = false;
+static uint32_t ADS1115Manager_readingSeq[4][4] = {0};
+static int32_t ADS1115Manager_ringSamples[4][4][16] = {0};
+static uint32_t ADS1115Manager_ringTimestamps[4][4][16] = {0};
+static uint8_t ADS1115Manager_ringHead[4][4] = {0};
+static uint8_t ADS1115Manager_ringCount[4][4] = {0};
+static int32_t ADS1115Manager_ringSum[4][4] = {0};
+static uint8_t ADS1115Manager_decimation[4][4] = {0};
+static int32_t ADS1115Manager_blockSum[4][4] = {0};
+static uint8_t ADS1115Manager_blockCount[4][4] = {0};
+static int32_t ADS1115Manager_decimatedSum[4][4] = {0};
+static uint8_t ADS1115Manager_decimatedCount[4][4] = {0};
+static uint32_t ADS1115Manager_decimatedTimestamp[4][4] = {0};
+static bool ADS1115Manager_decimatedValid[4][4] = {0};
+static uint32_t ADS1115Manager_decimatedSeq[4][4] = {0};
+static uint8_t ADS1115Manager_scanChannels[4][4] = {0};
+static uint8_t ADS1115Manager_scanLength[4] = {0, 0, 0, 0};
+static uint8_t ADS1115Manager_scanWeight[4][4] = {0};
+static uint8_t ADS1115Manager_scanRate[4][4] = {0};
+static int16_t ADS1115Manager_scanCredit[4][4] = {0};
+static uint8_t ADS1115Manager_scanWeightTotal[4] = {0, 0, 0, 0};
+static uint8_t ADS1115Manager_currentChannel[4] = {0, 0, 0, 0};
+static bool ADS1115Manager_conversionStarted[4] = {false, false, false, false};
+static uint32_t ADS1115Manager_conversionStartTime[4] = {0, 0, 0, 0};
+static bool ADS1115Manager_continuousMode[4] = {false, false, false, false};
+static uint8_t ADS1115Manager_pendingHandle[4] = {I2C_NO_HANDLE, I2C_NO_HANDLE, I2C_NO_HANDLE, I2C_NO_HANDLE};
+static bool ADS1115Manager_readPending[4] = {false, false, false, false};
+static bool ADS1115Manager_drdyReady[4] = {false, false, false, false};
+static uint32_t ADS1115Manager_drdyTimestamp[4] = {0, 0, 0, 0};
+static bool ADS1115Manager_discardResult[4] = {false, false, false, false};
+static EAdcHealth ADS1115Manager_health[4] = {};
+static uint8_t ADS1115Manager_consecutiveFailures[4] = {0};
+static uint8_t ADS1115Manager_reinitAttempts[4] = {0};
+static uint8_t ADS1115Manager_probeStep[4] = {0};
+static uint32_t ADS1115Manager_backoffMs[4] = {0};
+static uint32_t ADS1115Manager_backoffStart[4] = {0};
+static uint32_t ADS1115Manager_timeoutCount[4] = {0};
+static uint32_t ADS1115Manager_errorCount[4] = {0};
+static uint32_t ADS1115Manager_recoveryCount[4] = {0};
+static uint32_t ADS1115Manager_reinitCount[4] = {0};
+static uint16_t ADS1115Manager_sampleCounts[4][4] = {0};
+static float ADS1115Manager_sampleRates[4][4] = {0};
+static uint32_t ADS1115Manager_rateWindowStart = 0;
+
+static void ADS1115Manager_markReady(uint8_t device) {
+    ADS1115Manager_drdyTimestamp[device] = micros();
+    ADS1115Manager_drdyReady[device] = true;
+}
+
+static void ADS1115Manager_drdyIsr0(void) {
+    ADS1115Manager_markReady(0);
+}
+
+static void ADS1115Manager_drdyIsr1(void) {
+    ADS1115Manager_markReady(1);
+}
+
+static void ADS1115Manager_drdyIsr2(void) {
+    ADS1115Manager_markReady(2);
+}
+
+static void ADS1115Manager_drdyIsr3(void) {
+    ADS1115Manager_markReady(3);
+}
+
+static void ADS1115Manager_attachDrdyInterrupt(uint8_t device) {
+    uint8_t irq = digitalPinToInterrupt(ADS1115Manager_drdyPins[device]);
+    switch (device) {
+        case 0: {
+            attachInterrupt(irq, ADS1115Manager_drdyIsr0, FALLING);
+            break;
+        }
+        case 1: {
+            attachInterrupt(irq, ADS1115Manager_drdyIsr1, FALLING);
+            break;
+        }
+        case 2: {
+            attachInterrupt(irq, ADS1115Manager_drdyIsr2, FALLING);
+            break;
+        }
+        case 3: {
+            attachInterrupt(irq, ADS1115Manager_drdyIsr3, FALLING);
+            break;
+        }
+        default: {
+            return;
+            break;
+        }
+    }
+}
+
+static void ADS1115Manager_startConversion(uint8_t device) {
+    if (!ADS1115Manager_deviceInitialized[device]) {
+        ADS1115Manager_conversionStarted[device] = false;
+        return;
+    }
+    ADS1115Manager_drdyReady[device] = false;
+    ADS1115Manager_discardResult[device] = false;
+    uint8_t handle = I2C_NO_HANDLE;
+    if (ADS1115Manager_continuousMode[device]) {
+        handle = ADS1115Driver_startContinuous(device, ADS1115Manager_currentChannel[device]);
+    } else {
+        handle = ADS1115Driver_startSingle(device, ADS1115Manager_currentChannel[device]);
+    }
+    if (handle == I2C_NO_HANDLE) {
+        ADS1115Manager_conversionStarted[device] = false;
+        return;
+    }
+    ADS1115Manager_pendingHandle[device] = handle;
+    ADS1115Manager_readPending[device] = false;
+    ADS1115Manager_conversionStarted[device] = true;
+    ADS1115Manager_conversionStartTime[device] = millis();
+}
+
+static void ADS1115Manager_requestResult(uint8_t device) {
+    uint8_t handle = ADS1115Driver_requestResult(device);
+    if (handle == I2C_NO_HANDLE) {
         return;
     }
-    ADS1115Manager_ads[ADS1115Manager_currentDevice].startADCReading(ADS1115Manager_MUX_SINGLE[ADS1115Manager_currentChannel], false);
-    ADS1115Manager_conversionStarted = true;
-    ADS1115Manager_conversionStartTime = millis();
+    ADS1115Manager_drdyReady[device] = false;
+    ADS1115Manager_pendingHandle[device] = handle;
+    ADS1115Manager_readPending[device] = true;
 }
 
-static bool ADS1115Manager_isConversionComplete(void) {
-    if (!ADS1115Manager_conversionStarted || ADS1115Manager_currentDevice >= ADS_DEVICE_COUNT) {
+static bool ADS1115Manager_isConversionComplete(uint8_t device) {
+    if (!ADS1115Manager_conversionStarted[device]) {
         return false;
     }
-    int32_t pinState = digitalRead(ADS1115Manager_drdyPins[ADS1115Manager_currentDevice]);
-    if (pinState == LOW) {
+    return ADS1115Manager_drdyReady[device];
+}
+
+static void ADS1115Manager_publishReading(uint8_t device, uint8_t channel, int16_t raw, uint32_t timestamp, uint8_t gain, bool valid) {
+    ADS1115Manager_readingSeq[device][channel] = ADS1115Manager_readingSeq[device][channel] + 1;
+    __sync_synchronize();
+    ADS1115Manager_readings[device][channel].rawValue = raw;
+    ADS1115Manager_readings[device][channel].timestamp = timestamp;
+    ADS1115Manager_readings[device][channel].gain = gain;
+    ADS1115Manager_readings[device][channel].valid = valid;
+    __sync_synchronize();
+    ADS1115Manager_readingSeq[device][channel] = ADS1115Manager_readingSeq[device][channel] + 1;
+}
+
+static void ADS1115Manager_invalidateReading(uint8_t device, uint8_t channel) {
+    TAdcReading current = ADS1115Manager_readings[device][channel];
+    ADS1115Manager_publishReading(device, channel, current.rawValue, current.timestamp, current.gain, false);
+    ADS1115Manager_blockSum[device][channel] = 0;
+    ADS1115Manager_blockCount[device][channel] = 0;
+    ADS1115Manager_decimatedValid[device][channel] = false;
+    ADS1115Manager_decimatedSeq[device][channel] = ADS1115Manager_decimatedSeq[device][channel] + 1;
+}
+
+static void ADS1115Manager_resetHistory(uint8_t device, uint8_t channel) {
+    ADS1115Manager_ringHead[device][channel] = 0;
+    ADS1115Manager_ringCount[device][channel] = 0;
+    ADS1115Manager_ringSum[device][channel] = 0;
+    ADS1115Manager_blockSum[device][channel] = 0;
+    ADS1115Manager_blockCount[device][channel] = 0;
+    ADS1115Manager_decimatedSum[device][channel] = 0;
+    ADS1115Manager_decimatedCount[device][channel] = 0;
+    ADS1115Manager_decimatedTimestamp[device][channel] = 0;
+    ADS1115Manager_decimatedValid[device][channel] = false;
+    ADS1115Manager_decimatedSeq[device][channel] = ADS1115Manager_decimatedSeq[device][channel] + 1;
+}
+
+static void ADS1115Manager_pushSample(uint8_t device, uint8_t channel, int32_t sample, uint32_t timestamp) {
+    uint8_t head = ADS1115Manager_ringHead[device][channel];
+    if (ADS1115Manager_ringCount[device][channel] == 16) {
+        ADS1115Manager_ringSum[device][channel] = ADS1115Manager_ringSum[device][channel] - ADS1115Manager_ringSamples[device][channel][head];
+    } else {
+        ADS1115Manager_ringCount[device][channel] = ADS1115Manager_ringCount[device][channel] + 1;
+    }
+    ADS1115Manager_ringSamples[device][channel][head] = sample;
+    ADS1115Manager_ringTimestamps[device][channel][head] = timestamp;
+    ADS1115Manager_ringSum[device][channel] = ADS1115Manager_ringSum[device][channel] + sample;
+    head = head + 1;
+    if (head >= 16) {
+        head = 0;
+    }
+    ADS1115Manager_ringHead[device][channel] = head;
+    ADS1115Manager_blockSum[device][channel] = ADS1115Manager_blockSum[device][channel] + sample;
+    ADS1115Manager_blockCount[device][channel] = ADS1115Manager_blockCount[device][channel] + 1;
+    if (ADS1115Manager_blockCount[device][channel] >= ADS1115Manager_decimation[device][channel]) {
+        ADS1115Manager_decimatedSum[device][channel] = ADS1115Manager_blockSum[device][channel];
+        ADS1115Manager_decimatedCount[device][channel] = ADS1115Manager_blockCount[device][channel];
+        ADS1115Manager_decimatedTimestamp[device][channel] = timestamp;
+        ADS1115Manager_decimatedValid[device][channel] = true;
+        ADS1115Manager_blockSum[device][channel] = 0;
+        ADS1115Manager_blockCount[device][channel] = 0;
+        ADS1115Manager_decimatedSeq[device][channel] = ADS1115Manager_decimatedSeq[device][channel] + 1;
+    } else if (ADS1115Manager_decimatedCount[device][channel] == 0) {
+        ADS1115Manager_decimatedSeq[device][channel] = ADS1115Manager_decimatedSeq[device][channel] + 1;
+    }
+}
+
+static uint8_t ADS1115Manager_historyIndex(uint8_t device, uint8_t channel, uint8_t age) {
+    uint8_t index = ADS1115Manager_ringHead[device][channel] + 16 - 1 - age;
+    if (index >= 16) {
+        index = index - 16;
+    }
+    return index;
+}
+
+static bool ADS1115Manager_autoRange(uint8_t device, uint8_t channel, int16_t raw) {
+    uint8_t gain = ADS1115Driver_getGain(device, channel);
+    int32_t magnitude = static_cast<int32_t>(raw);
+    if (magnitude < 0) {
+        magnitude = -magnitude;
+    }
+    if (gain > 0 && magnitude >= 32767) {
+        ADS1115Driver_setGain(device, channel, gain - 1);
+        return true;
+    }
+    if (gain > 0 && magnitude > 29491) {
+        ADS1115Driver_setGain(device, channel, gain - 1);
+    }
+    if (gain < ADS1115Driver_GAIN_MAX && magnitude < 13107) {
+        ADS1115Driver_setGain(device, channel, gain + 1);
+    }
+    return false;
+}
+
+static bool ADS1115Manager_readResult(uint8_t device) {
+    if (!ADS1115Manager_deviceInitialized[device]) {
         return true;
     }
-    return ADS1115Manager_ads[ADS1115Manager_currentDevice].conversionComplete();
+    uint8_t channel = ADS1115Manager_currentChannel[device];
+    int16_t result = ADS1115Driver_getResult(ADS1115Manager_pendingHandle[device]);
+    uint8_t gain = ADS1115Driver_getGain(device, channel);
+    bool clipped = ADS1115Manager_autoRange(device, channel, result);
+    if (clipped) {
+        return false;
+    }
+    ADS1115Manager_publishReading(device, channel, result, ADS1115Manager_drdyTimestamp[device], gain, true);
+    int32_t sample = ADS1115Driver_toNormalized(gain, result);
+    ADS1115Manager_pushSample(device, channel, sample, ADS1115Manager_drdyTimestamp[device]);
+    ADS1115Manager_sampleCounts[device][channel] = ADS1115Manager_sampleCounts[device][channel] + 1;
+    return true;
 }
 
-static void ADS1115Manager_readResult(void) {
-    if (ADS1115Manager_currentDevice >= ADS_DEVICE_COUNT || !ADS1115Manager_deviceInitialized[ADS1115Manager_currentDevice]) {
+static void ADS1115Manager_advanceChannel(uint8_t device) {
+    uint8_t count = ADS1115Manager_scanLength[device];
+    if (count == 0) {
         return;
     }
-    int16_t result = ADS1115Manager_ads[ADS1115Manager_currentDevice].getLastConversionResults();
-    uint32_t now = millis();
-    {
-        uint32_t __primask = __cnx_get_PRIMASK();
-        __cnx_disable_irq();
-        ADS1115Manager_readings[ADS1115Manager_currentDevice][ADS1115Manager_currentChannel].rawValue = result;
-        ADS1115Manager_readings[ADS1115Manager_currentDevice][ADS1115Manager_currentChannel].timestamp = now;
-        ADS1115Manager_readings[ADS1115Manager_currentDevice][ADS1115Manager_currentChannel].valid = true;
-        __cnx_set_PRIMASK(__primask);
-    }
-    ADS1115Manager_conversionStarted = false;
-}
-
-static void ADS1115Manager_advanceChannel(void) {
-    ADS1115Manager_currentChannel = ADS1115Manager_currentChannel + 1;
-    if (ADS1115Manager_currentChannel >= 4) {
-        ADS1115Manager_currentChannel = 0;
-        ADS1115Manager_currentDevice = ADS1115Manager_currentDevice + 1;
-        while (ADS1115Manager_currentDevice < ADS_DEVICE_COUNT && !ADS1115Manager_deviceInitialized[ADS1115Manager_currentDevice]) {
-            ADS1115Manager_currentDevice = ADS1115Manager_currentDevice + 1;
+    uint8_t best = 0;
+    for (uint8_t i = 0; i < count; i = i + 1) {
+        ADS1115Manager_scanCredit[device][i] = ADS1115Manager_scanCredit[device][i] + static_cast<int16_t>(ADS1115Manager_scanWeight[device][i]);
+        if (ADS1115Manager_scanCredit[device][i] > ADS1115Manager_scanCredit[device][best]) {
+            best = i;
         }
-        if (ADS1115Manager_currentDevice >= ADS_DEVICE_COUNT) {
-            ADS1115Manager_currentDevice = 0;
-            while (ADS1115Manager_currentDevice < ADS_DEVICE_COUNT && !ADS1115Manager_deviceInitialized[ADS1115Manager_currentDevice]) {
-                ADS1115Manager_currentDevice = ADS1115Manager_currentDevice + 1;
-            }
+    }
+    ADS1115Manager_scanCredit[device][best] = ADS1115Manager_scanCredit[device][best] - static_cast<int16_t>(ADS1115Manager_scanWeightTotal[device]);
+    ADS1115Manager_currentChannel[device] = ADS1115Manager_scanChannels[device][best];
+}
+
+static void ADS1115Manager_addToScanPlan(uint8_t device, uint8_t channel, uint8_t priority, uint8_t rate) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return;
+    }
+    for (uint8_t i = 0; i < ADS1115Manager_scanLength[device]; i = i + 1) {
+        if (ADS1115Manager_scanChannels[device][i] == channel) {
+            return;
         }
     }
+    uint8_t weight = priority;
+    if (weight < 1) {
+        weight = 1;
+    }
+    if (weight > SAMPLE_PRIORITY_MAX) {
+        weight = SAMPLE_PRIORITY_MAX;
+    }
+    uint8_t entry = ADS1115Manager_scanLength[device];
+    ADS1115Manager_scanChannels[device][entry] = channel;
+    ADS1115Manager_scanWeight[device][entry] = weight;
+    ADS1115Manager_scanRate[device][entry] = rate;
+    ADS1115Manager_scanCredit[device][entry] = 0;
+    ADS1115Manager_scanWeightTotal[device] = ADS1115Manager_scanWeightTotal[device] + weight;
+    ADS1115Manager_scanLength[device] = entry + 1;
+    ADS1115Manager_deviceEnabled[device] = true;
 }
 
-void ADS1115Manager_initialize(const AppConfig& config) {
+static void ADS1115Manager_buildScanPlan(const AppConfig& config) {
     for (uint8_t d = 0; d < ADS_DEVICE_COUNT; d = d + 1) {
-        for (uint8_t c = 0; c < 4; c = c + 1) {
-            ADS1115Manager_readings[d][c].rawValue = 0;
-            ADS1115Manager_readings[d][c].timestamp = 0;
-            ADS1115Manager_readings[d][c].valid = false;
-        }
+        ADS1115Manager_scanLength[d] = 0;
+        ADS1115Manager_scanWeightTotal[d] = 0;
+        ADS1115Manager_deviceEnabled[d] = false;
     }
     for (uint8_t i = 0; i < TEMP_INPUT_COUNT; i = i + 1) {
         if (config.tempInputs[i].assignedValue != EValueId_VALUE_UNASSIGNED) {
-            uint8_t dev = HardwareMap_tempDevice(i);
-            ADS1115Manager_deviceEnabled[dev] = true;
+            THardwareMapping mapping = TEMP_HARDWARE_MAP[i];
+            ADS1115Manager_addToScanPlan(mapping.adsDevice, mapping.adsChannel, config.tempInputs[i].samplePriority, config.tempInputs[i].dataRate);
         }
     }
     for (uint8_t i = 0; i < PRESSURE_INPUT_COUNT; i = i + 1) {
         if (config.pressureInputs[i].assignedValue != EValueId_VALUE_UNASSIGNED) {
-            uint8_t dev = HardwareMap_pressureDevice(i);
-            ADS1115Manager_deviceEnabled[dev] = true;
+            THardwareMapping mapping = PRESSURE_HARDWARE_MAP[i];
+            ADS1115Manager_addToScanPlan(mapping.adsDevice, mapping.adsChannel, config.pressureInputs[i].samplePriority, config.pressureInputs[i].dataRate);
+        }
+    }
+}
+
+static void ADS1115Manager_applyScanRates(uint8_t device) {
+    for (uint8_t i = 0; i < ADS1115Manager_scanLength[device]; i = i + 1) {
+        ADS1115Driver_setDataRate(device, ADS1115Manager_scanChannels[device][i], ADS1115Manager_scanRate[device][i]);
+    }
+}
+
+static void ADS1115Manager_scheduleRetry(uint8_t device) {
+    ADS1115Manager_backoffStart[device] = millis();
+    if (ADS1115Manager_reinitAttempts[device] >= 5) {
+        ADS1115Manager_backoffMs[device] = 30000;
+        ADS1115Manager_health[device] = EAdcHealth_ADC_QUARANTINED;
+    } else {
+        ADS1115Manager_health[device] = EAdcHealth_ADC_BACKOFF;
+    }
+}
+
+static void ADS1115Manager_beginRecovery(uint8_t device) {
+    ADS1115Manager_deviceInitialized[device] = false;
+    ADS1115Manager_conversionStarted[device] = false;
+    for (uint8_t c = 0; c < 4; c = c + 1) {
+        ADS1115Manager_invalidateReading(device, c);
+    }
+    ADS1115Manager_recoveryCount[device] = ADS1115Manager_recoveryCount[device] + 1;
+    ADS1115Manager_consecutiveFailures[device] = 0;
+    ADS1115Manager_reinitAttempts[device] = 0;
+    ADS1115Manager_backoffMs[device] = 100;
+    I2cBus_clearBus();
+    ADS1115Driver_invalidatePointer(device);
+    ADS1115Manager_scheduleRetry(device);
+}
+
+static void ADS1115Manager_recordFailure(uint8_t device) {
+    ADS1115Manager_consecutiveFailures[device] = ADS1115Manager_consecutiveFailures[device] + 1;
+    if (ADS1115Manager_consecutiveFailures[device] >= 3) {
+        ADS1115Manager_beginRecovery(device);
+    }
+}
+
+static void ADS1115Manager_probeFailed(uint8_t device) {
+    ADS1115Driver_invalidatePointer(device);
+    ADS1115Manager_reinitAttempts[device] = ADS1115Manager_reinitAttempts[device] + 1;
+    uint32_t next = ADS1115Manager_backoffMs[device] * 2;
+    if (next > 30000) {
+        next = 30000;
+    }
+    ADS1115Manager_backoffMs[device] = next;
+    ADS1115Manager_scheduleRetry(device);
+}
+
+static void ADS1115Manager_completeRecovery(uint8_t device) {
+    ADS1115Driver_resetChannels(device);
+    ADS1115Manager_applyScanRates(device);
+    for (uint8_t c = 0; c < 4; c = c + 1) {
+        ADS1115Manager_resetHistory(device, c);
+    }
+    ADS1115Manager_health[device] = EAdcHealth_ADC_HEALTHY;
+    ADS1115Manager_consecutiveFailures[device] = 0;
+    ADS1115Manager_reinitCount[device] = ADS1115Manager_reinitCount[device] + 1;
+    ADS1115Manager_deviceInitialized[device] = true;
+    ADS1115Manager_startConversion(device);
+}
+
+static void ADS1115Manager_updateRecovery(uint8_t device) {
+    if (ADS1115Manager_pendingHandle[device] != I2C_NO_HANDLE) {
+        EI2cStatus status = I2cBus_getStatus(ADS1115Manager_pendingHandle[device]);
+        bool inFlight = status == EI2cStatus_I2C_PENDING || status == EI2cStatus_I2C_ACTIVE;
+        if (inFlight) {
+            return;
+        }
+        I2cBus_release(ADS1115Manager_pendingHandle[device]);
+        ADS1115Manager_pendingHandle[device] = I2C_NO_HANDLE;
+        if (status != EI2cStatus_I2C_DONE) {
+            ADS1115Manager_probeFailed(device);
+            return;
+        }
+        ADS1115Manager_probeStep[device] = ADS1115Manager_probeStep[device] + 1;
+        if (ADS1115Manager_probeStep[device] >= 2) {
+            ADS1115Manager_completeRecovery(device);
         }
+        return;
+    }
+    if (ADS1115Manager_health[device] == EAdcHealth_ADC_PROBING) {
+        bool high = ADS1115Manager_probeStep[device] == 0;
+        ADS1115Manager_pendingHandle[device] = ADS1115Driver_submitRdyThreshold(device, high);
+        return;
+    }
+    uint32_t elapsed = millis() - ADS1115Manager_backoffStart[device];
+    if (elapsed >= ADS1115Manager_backoffMs[device]) {
+        ADS1115Manager_probeStep[device] = 0;
+        ADS1115Manager_health[device] = EAdcHealth_ADC_PROBING;
     }
+}
+
+static bool ADS1115Manager_completeTransaction(uint8_t device, EI2cStatus status) {
+    bool wasRead = ADS1115Manager_readPending[device];
+    bool succeeded = status == EI2cStatus_I2C_DONE;
+    bool discarded = wasRead && ADS1115Manager_discardResult[device];
+    if (wasRead) {
+        ADS1115Manager_discardResult[device] = false;
+    }
+    uint8_t gainBefore = ADS1115Driver_getGain(device, ADS1115Manager_currentChannel[device]);
+    bool stored = false;
+    if (wasRead && succeeded && !discarded) {
+        stored = ADS1115Manager_readResult(device);
+    }
+    bool rangeChanged = ADS1115Driver_getGain(device, ADS1115Manager_currentChannel[device]) != gainBefore;
+    if (stored) {
+        ADS1115Manager_consecutiveFailures[device] = 0;
+    }
+    I2cBus_release(ADS1115Manager_pendingHandle[device]);
+    ADS1115Manager_pendingHandle[device] = I2C_NO_HANDLE;
+    ADS1115Manager_readPending[device] = false;
+    if (!succeeded) {
+        ADS1115Manager_errorCount[device] = ADS1115Manager_errorCount[device] + 1;
+        ADS1115Driver_invalidatePointer(device);
+        ADS1115Manager_invalidateReading(device, ADS1115Manager_currentChannel[device]);
+        ADS1115Manager_conversionStarted[device] = false;
+        ADS1115Manager_advanceChannel(device);
+        ADS1115Manager_recordFailure(device);
+        return false;
+    }
+    if (discarded) {
+        ADS1115Manager_conversionStartTime[device] = millis();
+        return false;
+    }
+    if (wasRead && !stored) {
+        ADS1115Manager_conversionStarted[device] = false;
+        ADS1115Manager_startConversion(device);
+        return false;
+    }
+    if (wasRead && ADS1115Manager_continuousMode[device] && !rangeChanged) {
+        ADS1115Manager_conversionStartTime[device] = millis();
+        return true;
+    }
+    if (wasRead) {
+        ADS1115Manager_conversionStarted[device] = false;
+        ADS1115Manager_advanceChannel(device);
+        ADS1115Manager_startConversion(device);
+        return true;
+    }
+    ADS1115Manager_drdyReady[device] = false;
+    ADS1115Manager_discardResult[device] = ADS1115Manager_continuousMode[device];
+    return false;
+}
+
+static bool ADS1115Manager_updateDevice(uint8_t device) {
+    if (!ADS1115Manager_deviceInitialized[device]) {
+        bool recovering = ADS1115Manager_health[device] != EAdcHealth_ADC_UNUSED;
+        if (recovering) {
+            ADS1115Manager_updateRecovery(device);
+        }
+        return false;
+    }
+    if (ADS1115Manager_pendingHandle[device] != I2C_NO_HANDLE) {
+        EI2cStatus status = I2cBus_getStatus(ADS1115Manager_pendingHandle[device]);
+        bool inFlight = status == EI2cStatus_I2C_PENDING || status == EI2cStatus_I2C_ACTIVE;
+        if (inFlight) {
+            return false;
+        }
+        return ADS1115Manager_completeTransaction(device, status);
+    }
+    if (!ADS1115Manager_conversionStarted[device]) {
+        ADS1115Manager_startConversion(device);
+        return false;
+    }
+    bool conversionDone = ADS1115Manager_isConversionComplete(device);
+    if (conversionDone) {
+        ADS1115Manager_requestResult(device);
+        return false;
+    }
+    uint32_t elapsed = millis() - ADS1115Manager_conversionStartTime[device];
+    uint32_t timeout = ADS1115Driver_conversionTimeoutMs(device, ADS1115Manager_currentChannel[device]);
+    if (elapsed > timeout) {
+        ADS1115Manager_timeoutCount[device] = ADS1115Manager_timeoutCount[device] + 1;
+        ADS1115Manager_invalidateReading(device, ADS1115Manager_currentChannel[device]);
+        ADS1115Manager_advanceChannel(device);
+        ADS1115Manager_recordFailure(device);
+        ADS1115Manager_startConversion(device);
+    }
+    return false;
+}
+
+static void ADS1115Manager_updateSampleRates(void) {
+    uint32_t now = millis();
+    uint32_t elapsed = now - ADS1115Manager_rateWindowStart;
+    if (elapsed < 1000) {
+        return;
+    }
+    for (uint8_t d = 0; d < ADS_DEVICE_COUNT; d = d + 1) {
+        for (uint8_t c = 0; c < 4; c = c + 1) {
+            ADS1115Manager_sampleRates[d][c] = static_cast<float>(ADS1115Manager_sampleCounts[d][c]) * 1000.0 / static_cast<float>(elapsed);
+            ADS1115Manager_sampleCounts[d][c] = 0;
+        }
+    }
+    ADS1115Manager_rateWindowStart = now;
+}
+
+void ADS1115Manager_initialize(const AppConfig& config) {
+    for (uint8_t d = 0; d < ADS_DEVICE_COUNT; d = d + 1) {
+        for (uint8_t c = 0; c < 4; c = c + 1) {
+            ADS1115Manager_publishReading(d, c, 0, 0, 0, false);
+            ADS1115Manager_sampleCounts[d][c] = 0;
+            ADS1115Manager_sampleRates[d][c] = 0.0;
+            if (ADS1115Manager_decimation[d][c] == 0) {
+                ADS1115Manager_decimation[d][c] = 4;
+            }
+            ADS1115Manager_resetHistory(d, c);
+        }
+    }
+    ADS1115Manager_rateWindowStart = millis();
+    ADS1115Manager_buildScanPlan(config);
     for (uint8_t d = 0; d < ADS_DEVICE_COUNT; d = d + 1) {
         ADS1115Manager_drdyPins[d] = ADS_DRDY_PINS[d];
+        detachInterrupt(digitalPinToInterrupt(ADS1115Manager_drdyPins[d]));
+        ADS1115Manager_drdyReady[d] = false;
+        ADS1115Manager_consecutiveFailures[d] = 0;
+        ADS1115Manager_reinitAttempts[d] = 0;
+        ADS1115Manager_backoffMs[d] = 100;
         if (!ADS1115Manager_deviceEnabled[d]) {
             ADS1115Manager_deviceInitialized[d] = false;
+            ADS1115Manager_health[d] = EAdcHealth_ADC_UNUSED;
             continue;
         }
         pinMode(ADS1115Manager_drdyPins[d], INPUT);
+        ADS1115Manager_continuousMode[d] = ADS1115Manager_scanLength[d] == 1;
         uint8_t addr = ADS_I2C_ADDRESSES[d];
-        bool beginResult = ADS1115Manager_ads[d].begin(addr);
+        bool beginResult = ADS1115Driver_begin(d);
+        ADS1115Manager_attachDrdyInterrupt(d);
         if (beginResult) {
+            ADS1115Manager_applyScanRates(d);
             ADS1115Manager_deviceInitialized[d] = true;
-            ADS1115Manager_ads[d].setDataRate(0x0080);
+            ADS1115Manager_health[d] = EAdcHealth_ADC_HEALTHY;
             Serial.print("ADS1115 @ 0x");
             Serial.print(addr, HEX);
             Serial.print(" initialized, DRDY pin D");
@@ -158,64 +564,50 @@ void ADS1115Manager_initialize(const AppConfig& config) {
             ADS1115Manager_deviceInitialized[d] = false;
             Serial.print("ADS1115 @ 0x");
             Serial.print(addr, HEX);
-            Serial.println(" FAILED to initialize");
+            Serial.println(" FAILED to initialize - will retry");
+            ADS1115Manager_scheduleRetry(d);
         }
     }
-    ADS1115Manager_currentDevice = 0;
-    ADS1115Manager_currentChannel = 0;
-    ADS1115Manager_conversionStarted = false;
-    while (ADS1115Manager_currentDevice < ADS_DEVICE_COUNT && !ADS1115Manager_deviceInitialized[ADS1115Manager_currentDevice]) {
-        ADS1115Manager_currentDevice = ADS1115Manager_currentDevice + 1;
-    }
-    if (ADS1115Manager_currentDevice < ADS_DEVICE_COUNT) {
-        ADS1115Manager_startConversion();
+    for (uint8_t d = 0; d < ADS_DEVICE_COUNT; d = d + 1) {
+        ADS1115Manager_advanceChannel(d);
+        ADS1115Manager_conversionStarted[d] = false;
+        ADS1115Manager_pendingHandle[d] = I2C_NO_HANDLE;
+        ADS1115Manager_readPending[d] = false;
+        ADS1115Manager_startConversion(d);
     }
 }
 
 bool ADS1115Manager_update(void) {
-    if (ADS1115Manager_currentDevice >= ADS_DEVICE_COUNT) {
-        return false;
-    }
-    if (!ADS1115Manager_conversionStarted) {
-        ADS1115Manager_startConversion();
-        return false;
-    }
-    bool conversionDone = ADS1115Manager_isConversionComplete();
-    if (conversionDone) {
-        ADS1115Manager_readResult();
-        ADS1115Manager_advanceChannel();
-        if (ADS1115Manager_currentDevice < ADS_DEVICE_COUNT) {
-            ADS1115Manager_startConversion();
-        }
-        return true;
-    }
-    uint32_t elapsed = millis() - ADS1115Manager_conversionStartTime;
-    if (elapsed > 15) {
-        Serial.print("ADS1115 timeout on device ");
-        Serial.print(ADS1115Manager_currentDevice);
-        Serial.print(" channel ");
-        Serial.println(ADS1115Manager_currentChannel);
-        ADS1115Manager_readings[ADS1115Manager_currentDevice][ADS1115Manager_currentChannel].valid = false;
-        ADS1115Manager_advanceChannel();
-        if (ADS1115Manager_currentDevice < ADS_DEVICE_COUNT) {
-            ADS1115Manager_startConversion();
+    ADS1115Manager_updateSampleRates();
+    bool anyCompleted = false;
+    for (uint8_t d = 0; d < ADS_DEVICE_COUNT; d = d + 1) {
+        bool completed = ADS1115Manager_updateDevice(d);
+        if (completed) {
+            anyCompleted = true;
         }
     }
-    return false;
+    return anyCompleted;
 }
 
 TAdcReading ADS1115Manager_getReading(uint8_t device, uint8_t channel) {
-    TAdcReading copy = (TAdcReading){ .rawValue = 0, .timestamp = 0, .valid = false };
+    TAdcReading copy = (TAdcReading){ .rawValue = 0, .timestamp = 0, .gain = 0, .valid = false };
     if (device >= ADS_DEVICE_COUNT || channel >= 4) {
         return copy;
     }
-    {
-        uint32_t __primask = __cnx_get_PRIMASK();
-        __cnx_disable_irq();
+    bool stable = false;
+    for (uint8_t attempt = 0; attempt < 4 && !stable; attempt = attempt + 1) {
+        uint32_t before = ADS1115Manager_readingSeq[device][channel];
+        __sync_synchronize();
         copy.rawValue = ADS1115Manager_readings[device][channel].rawValue;
         copy.timestamp = ADS1115Manager_readings[device][channel].timestamp;
+        copy.gain = ADS1115Manager_readings[device][channel].gain;
         copy.valid = ADS1115Manager_readings[device][channel].valid;
-        __cnx_set_PRIMASK(__primask);
+        __sync_synchronize();
+        uint32_t after = ADS1115Manager_readingSeq[device][channel];
+        stable = before == after && (before & 1) == 0;
+    }
+    if (!stable) {
+        copy.valid = false;
     }
     return copy;
 }
@@ -225,7 +617,176 @@ float ADS1115Manager_getVoltage(uint8_t device, uint8_t channel) {
     if (!reading.valid) {
         return 0.0;
     }
-    return ADS1115Manager_ads[device].computeVolts(reading.rawValue);
+    return ADS1115Driver_toVolts(reading.gain, reading.rawValue);
+}
+
+float ADS1115Manager_getMeanVoltage(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0.0;
+    }
+    uint8_t count = ADS1115Manager_ringCount[device][channel];
+    if (count == 0) {
+        return 0.0;
+    }
+    float mean = static_cast<float>(ADS1115Manager_ringSum[device][channel]) / static_cast<float>(count);
+    return ADS1115Driver_normalizedToVolts(mean);
+}
+
+float ADS1115Manager_getDecimatedVoltage(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0.0;
+    }
+    uint8_t count = ADS1115Manager_decimatedCount[device][channel];
+    if (count == 0) {
+        return ADS1115Manager_getVoltage(device, channel);
+    }
+    float mean = static_cast<float>(ADS1115Manager_decimatedSum[device][channel]) / static_cast<float>(count);
+    return ADS1115Driver_normalizedToVolts(mean);
+}
+
+int32_t ADS1115Manager_getDecimatedCounts(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    uint8_t count = ADS1115Manager_decimatedCount[device][channel];
+    if (count == 0) {
+        TAdcReading reading = ADS1115Manager_getReading(device, channel);
+        if (!reading.valid) {
+            return 0;
+        }
+        return ADS1115Driver_toNormalized(reading.gain, reading.rawValue);
+    }
+    return ADS1115Manager_decimatedSum[device][channel] / static_cast<int32_t>(count);
+}
+
+uint32_t ADS1115Manager_getDecimatedTimestamp(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    return ADS1115Manager_decimatedTimestamp[device][channel];
+}
+
+bool ADS1115Manager_isDecimatedValid(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return false;
+    }
+    if (ADS1115Manager_decimatedCount[device][channel] == 0) {
+        TAdcReading reading = ADS1115Manager_getReading(device, channel);
+        return reading.valid;
+    }
+    return ADS1115Manager_decimatedValid[device][channel];
+}
+
+static uint32_t ADS1115Manager_coveredSpanUs(uint32_t elapsedUs, int32_t n) {
+    if (n < 2) {
+        return 0;
+    }
+    return elapsedUs + elapsedUs / static_cast<uint32_t>((n - 1));
+}
+
+uint32_t ADS1115Manager_getHistorySpanUs(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    uint8_t count = ADS1115Manager_ringCount[device][channel];
+    if (count < 2) {
+        return 0;
+    }
+    uint8_t newestIndex = ADS1115Manager_historyIndex(device, channel, 0);
+    uint8_t oldestIndex = ADS1115Manager_historyIndex(device, channel, count - 1);
+    uint32_t elapsed = ADS1115Manager_ringTimestamps[device][channel][newestIndex] - ADS1115Manager_ringTimestamps[device][channel][oldestIndex];
+    return ADS1115Manager_coveredSpanUs(elapsed, static_cast<int32_t>(count));
+}
+
+TWindowAverage ADS1115Manager_getWindowCounts(uint8_t device, uint8_t channel, uint32_t windowUs) {
+    TWindowAverage result = (TWindowAverage){ .counts = 0, .spanUs = 0 };
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return result;
+    }
+    uint8_t count = ADS1115Manager_ringCount[device][channel];
+    if (count == 0) {
+        result.counts = ADS1115Manager_getDecimatedCounts(device, channel);
+        return result;
+    }
+    uint8_t newestIndex = ADS1115Manager_historyIndex(device, channel, 0);
+    uint32_t newest = ADS1115Manager_ringTimestamps[device][channel][newestIndex];
+    uint32_t oldest = newest;
+    int32_t sum = ADS1115Manager_ringSamples[device][channel][newestIndex];
+    int32_t n = 1;
+    uint8_t age = 1;
+    bool inWindow = true;
+    while (age < count && inWindow) {
+        uint8_t index = ADS1115Manager_historyIndex(device, channel, age);
+        inWindow = newest - ADS1115Manager_ringTimestamps[device][channel][index] < windowUs;
+        if (inWindow) {
+            sum = sum + ADS1115Manager_ringSamples[device][channel][index];
+            oldest = ADS1115Manager_ringTimestamps[device][channel][index];
+            n = n + 1;
+        }
+        age = age + 1;
+    }
+    result.counts = sum / n;
+    result.spanUs = ADS1115Manager_coveredSpanUs(newest - oldest, n);
+    return result;
+}
+
+uint32_t ADS1115Manager_getDecimatedSeq(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    return ADS1115Manager_decimatedSeq[device][channel];
+}
+
+void ADS1115Manager_setDecimation(uint8_t device, uint8_t channel, uint8_t factor) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return;
+    }
+    uint8_t clamped = factor;
+    if (clamped < 1) {
+        clamped = 1;
+    }
+    if (clamped > 64) {
+        clamped = 64;
+    }
+    ADS1115Manager_decimation[device][channel] = clamped;
+    ADS1115Manager_blockSum[device][channel] = 0;
+    ADS1115Manager_blockCount[device][channel] = 0;
+}
+
+uint8_t ADS1115Manager_getHistoryCount(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    return ADS1115Manager_ringCount[device][channel];
+}
+
+float ADS1115Manager_getHistoryVoltage(uint8_t device, uint8_t channel, uint8_t age) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0.0;
+    }
+    if (age >= ADS1115Manager_ringCount[device][channel]) {
+        return 0.0;
+    }
+    uint8_t index = ADS1115Manager_historyIndex(device, channel, age);
+    return ADS1115Driver_normalizedToVolts(static_cast<float>(ADS1115Manager_ringSamples[device][channel][index]));
+}
+
+uint32_t ADS1115Manager_getHistoryTimestamp(uint8_t device, uint8_t channel, uint8_t age) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0;
+    }
+    if (age >= ADS1115Manager_ringCount[device][channel]) {
+        return 0;
+    }
+    uint8_t index = ADS1115Manager_historyIndex(device, channel, age);
+    return ADS1115Manager_ringTimestamps[device][channel][index];
+}
+
+float ADS1115Manager_getSampleRate(uint8_t device, uint8_t channel) {
+    if (device >= ADS_DEVICE_COUNT || channel >= 4) {
+        return 0.0;
+    }
+    return ADS1115Manager_sampleRates[device][channel];
 }
 
 bool ADS1115Manager_isDeviceEnabled(uint8_t device) {
@@ -235,6 +796,41 @@ bool ADS1115Manager_isDeviceEnabled(uint8_t device) {
     return ADS1115Manager_deviceEnabled[device] && ADS1115Manager_deviceInitialized[device];
 }
 
+EAdcHealth ADS1115Manager_getHealth(uint8_t device) {
+    if (device >= ADS_DEVICE_COUNT) {
+        return EAdcHealth_ADC_UNUSED;
+    }
+    return ADS1115Manager_health[device];
+}
+
+uint32_t ADS1115Manager_getTimeoutCount(uint8_t device) {
+    if (device >= ADS_DEVICE_COUNT) {
+        return 0;
+    }
+    return ADS1115Manager_timeoutCount[device];
+}
+
+uint32_t ADS1115Manager_getErrorCount(uint8_t device) {
+    if (device >= ADS_DEVICE_COUNT) {
+        return 0;
+    }
+    return ADS1115Manager_errorCount[device];
+}
+
+uint32_t ADS1115Manager_getRecoveryCount(uint8_t device) {
+    if (device >= ADS_DEVICE_COUNT) {
+        return 0;
+    }
+    return ADS1115Manager_recoveryCount[device];
+}
+
+uint32_t ADS1115Manager_getReinitCount(uint8_t device) {
+    if (device >= ADS_DEVICE_COUNT) {
+        return 0;
+    }
+    return ADS1115Manager_reinitCount[device];
+}
+
 void ADS1115Manager_printDebugInfo(void) {
     Serial.println("=== ADS1115 Debug ===");
     for (uint8_t d = 0; d < ADS_DEVICE_COUNT; d = d + 1) {
@@ -245,21 +841,47 @@ void ADS1115Manager_printDebugInfo(void) {
         Serial.print("): enabled=");
         Serial.print(ADS1115Manager_deviceEnabled[d]);
         Serial.print(" init=");
-        Serial.println(ADS1115Manager_deviceInitialized[d]);
+        Serial.print(ADS1115Manager_deviceInitialized[d]);
+        Serial.print(" scan=");
+        Serial.print(ADS1115Manager_scanLength[d]);
+        Serial.print(" continuous=");
+        Serial.println(ADS1115Manager_continuousMode[d]);
+        Serial.print("  health=");
+        Serial.print(static_cast<uint8_t>(ADS1115Manager_health[d]));
+        Serial.print(" timeouts=");
+        Serial.print(ADS1115Manager_timeoutCount[d]);
+        Serial.print(" errors=");
+        Serial.print(ADS1115Manager_errorCount[d]);
+        Serial.print(" recoveries=");
+        Serial.print(ADS1115Manager_recoveryCount[d]);
+        Serial.print(" reinits=");
+        Serial.print(ADS1115Manager_reinitCount[d]);
+        Serial.print(" backoff=");
+        Serial.println(ADS1115Manager_backoffMs[d]);
         if (ADS1115Manager_deviceInitialized[d]) {
             for (uint8_t c = 0; c < 4; c = c + 1) {
-                TAdcReading reading = ADS1115Manager_readings[d][c];
+                TAdcReading reading = ADS1115Manager_getReading(d, c);
                 Serial.print("  Ch");
                 Serial.print(c);
                 Serial.print(": raw=");
                 Serial.print(reading.rawValue);
+                Serial.print(" gain=");
+                Serial.print(reading.gain);
                 Serial.print(" valid=");
                 Serial.print(reading.valid);
                 if (reading.valid) {
-                    float volts = ADS1115Manager_ads[d].computeVolts(reading.rawValue);
+                    float volts = ADS1115Driver_toVolts(reading.gain, reading.rawValue);
                     Serial.print(" volts=");
                     Serial.print(volts, 3);
+                    float decimated = ADS1115Manager_getDecimatedVoltage(d, c);
+                    Serial.print(" dec=");
+                    Serial.print(decimated, 4);
                 }
+                Serial.print(" dr=");
+                Serial.print(ADS1115Driver_getDataRateSps(d, c));
+                Serial.print(" rate=");
+                Serial.print(ADS1115Manager_sampleRates[d][c], 1);
+                Serial.print("Hz");
                 Serial.println();
             }
         }
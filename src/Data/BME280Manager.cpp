@@ -11,6 +11,8 @@
 #include <AppConfig.h>
 #include <Arduino.h>
 #include <Wire.h>
+#include "I2cBus.h"
+#include <Display/ByteUtils.h>
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -25,43 +27,194 @@ static float BME280Manager_humidity = 0.0;
 static float BME280Manager_pressurekPa = 0.0;
 static bool BME280Manager_readingValid = false;
 static uint32_t BME280Manager_lastReadTime = 0;
+static uint8_t BME280Manager_readHandle = I2C_NO_HANDLE;
+static uint32_t BME280Manager_errorCount = 0;
+static EI2cStatus BME280Manager_lastError = EI2cStatus_I2C_DONE;
+static uint16_t BME280Manager_digT1 = 0;
+static int16_t BME280Manager_digT2 = 0;
+static int16_t BME280Manager_digT3 = 0;
+static uint16_t BME280Manager_digP1 = 0;
+static int16_t BME280Manager_digP2 = 0;
+static int16_t BME280Manager_digP3 = 0;
+static int16_t BME280Manager_digP4 = 0;
+static int16_t BME280Manager_digP5 = 0;
+static int16_t BME280Manager_digP6 = 0;
+static int16_t BME280Manager_digP7 = 0;
+static int16_t BME280Manager_digP8 = 0;
+static int16_t BME280Manager_digP9 = 0;
+static uint8_t BME280Manager_digH1 = 0;
+static int16_t BME280Manager_digH2 = 0;
+static uint8_t BME280Manager_digH3 = 0;
+static int16_t BME280Manager_digH4 = 0;
+static int16_t BME280Manager_digH5 = 0;
+static int8_t BME280Manager_digH6 = 0;
+static int32_t BME280Manager_tFine = 0;
+
+static bool BME280Manager_readCalibration(void) {
+    uint8_t buf[8] = {0};
+    EI2cStatus status = I2cBus_readBlocking(BME280Manager_i2cAddress, 0x88, 8, buf);
+    if (status != EI2cStatus_I2C_DONE) {
+        return false;
+    }
+    BME280Manager_digT1 = ByteUtils_makeU16LE(buf[0], buf[1]);
+    BME280Manager_digT2 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[2], buf[3]));
+    BME280Manager_digT3 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[4], buf[5]));
+    BME280Manager_digP1 = ByteUtils_makeU16LE(buf[6], buf[7]);
+    status = I2cBus_readBlocking(BME280Manager_i2cAddress, 0x90, 8, buf);
+    if (status != EI2cStatus_I2C_DONE) {
+        return false;
+    }
+    BME280Manager_digP2 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[0], buf[1]));
+    BME280Manager_digP3 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[2], buf[3]));
+    BME280Manager_digP4 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[4], buf[5]));
+    BME280Manager_digP5 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[6], buf[7]));
+    status = I2cBus_readBlocking(BME280Manager_i2cAddress, 0x98, 8, buf);
+    if (status != EI2cStatus_I2C_DONE) {
+        return false;
+    }
+    BME280Manager_digP6 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[0], buf[1]));
+    BME280Manager_digP7 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[2], buf[3]));
+    BME280Manager_digP8 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[4], buf[5]));
+    BME280Manager_digP9 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[6], buf[7]));
+    status = I2cBus_readBlocking(BME280Manager_i2cAddress, 0xA1, 1, buf);
+    if (status != EI2cStatus_I2C_DONE) {
+        return false;
+    }
+    BME280Manager_digH1 = buf[0];
+    status = I2cBus_readBlocking(BME280Manager_i2cAddress, 0xE1, 7, buf);
+    if (status != EI2cStatus_I2C_DONE) {
+        return false;
+    }
+    BME280Manager_digH2 = static_cast<int16_t>(ByteUtils_makeU16LE(buf[0], buf[1]));
+    BME280Manager_digH3 = buf[2];
+    BME280Manager_digH4 = static_cast<int16_t>((static_cast<int8_t>(buf[3]))) * 16 + static_cast<int16_t>((buf[4] & 0x0F));
+    BME280Manager_digH5 = static_cast<int16_t>((static_cast<int8_t>(buf[5]))) * 16 + static_cast<int16_t>((buf[4] >> 4));
+    BME280Manager_digH6 = static_cast<int8_t>(buf[6]);
+    return true;
+}
+
+static float BME280Manager_compensateTemperature(int32_t adcT) {
+    int32_t var1 = (adcT / 8) - (static_cast<int32_t>(BME280Manager_digT1) * 2);
+    var1 = (var1 * static_cast<int32_t>(BME280Manager_digT2)) / 2048;
+    int32_t var2 = (adcT / 16) - static_cast<int32_t>(BME280Manager_digT1);
+    var2 = (((var2 * var2) / 4096) * static_cast<int32_t>(BME280Manager_digT3)) / 16384;
+    BME280Manager_tFine = var1 + var2;
+    int32_t t = (BME280Manager_tFine * 5 + 128) / 256;
+    return static_cast<float>(t) / 100.0;
+}
+
+static float BME280Manager_compensatePressure(int32_t adcP) {
+    int64_t var1 = static_cast<int64_t>(BME280Manager_tFine) - 128000;
+    int64_t var2 = var1 * var1 * static_cast<int64_t>(BME280Manager_digP6);
+    var2 = var2 + ((var1 * static_cast<int64_t>(BME280Manager_digP5)) * 131072);
+    var2 = var2 + (static_cast<int64_t>(BME280Manager_digP4) * 34359738368);
+    var1 = ((var1 * var1 * static_cast<int64_t>(BME280Manager_digP3)) / 256) + ((var1 * static_cast<int64_t>(BME280Manager_digP2)) * 4096);
+    var1 = (140737488355328 + var1) * static_cast<int64_t>(BME280Manager_digP1) / 8589934592;
+    if (var1 == 0) {
+        return 0.0;
+    }
+    int64_t p = 1048576 - static_cast<int64_t>(adcP);
+    p = (((p * 2147483648) - var2) * 3125) / var1;
+    var1 = (static_cast<int64_t>(BME280Manager_digP9) * (p / 8192) * (p / 8192)) / 33554432;
+    var2 = (static_cast<int64_t>(BME280Manager_digP8) * p) / 524288;
+    p = ((p + var1 + var2) / 256) + (static_cast<int64_t>(BME280Manager_digP7) * 16);
+    return static_cast<float>(p) / 256.0;
+}
+
+static float BME280Manager_compensateHumidity(int32_t adcH) {
+    int32_t var1 = BME280Manager_tFine - 76800;
+    int32_t var2 = adcH * 16384;
+    int32_t var3 = static_cast<int32_t>(BME280Manager_digH4) * 1048576;
+    int32_t var4 = static_cast<int32_t>(BME280Manager_digH5) * var1;
+    int32_t var5 = (((var2 - var3) - var4) + 16384) / 32768;
+    var2 = (var1 * static_cast<int32_t>(BME280Manager_digH6)) / 1024;
+    var3 = (var1 * static_cast<int32_t>(BME280Manager_digH3)) / 2048;
+    var4 = ((var2 * (var3 + 32768)) / 1024) + 2097152;
+    var2 = ((var4 * static_cast<int32_t>(BME280Manager_digH2)) + 8192) / 16384;
+    var3 = var5 * var2;
+    var4 = ((var3 / 32768) * (var3 / 32768)) / 128;
+    var5 = var3 - ((var4 * static_cast<int32_t>(BME280Manager_digH1)) / 16);
+    if (var5 < 0) {
+        var5 = 0;
+    }
+    if (var5 > 419430400) {
+        var5 = 419430400;
+    }
+    return static_cast<float>((var5 / 4096)) / 1024.0;
+}
+
+static void BME280Manager_processBurst(void) {
+    uint8_t data[8] = {0};
+    for (uint8_t i = 0; i < 8; i = i + 1) {
+        data[i] = I2cBus_getByte(BME280Manager_readHandle, i);
+    }
+    int32_t adcP = (static_cast<int32_t>(data[0]) * 4096) + (static_cast<int32_t>(data[1]) * 16) + (static_cast<int32_t>(data[2]) / 16);
+    int32_t adcT = (static_cast<int32_t>(data[3]) * 4096) + (static_cast<int32_t>(data[4]) * 16) + (static_cast<int32_t>(data[5]) / 16);
+    int32_t adcH = (static_cast<int32_t>(data[6]) * 256) + static_cast<int32_t>(data[7]);
+    if (adcT == 0x80000 || adcP == 0x80000 || adcH == 0x8000) {
+        BME280Manager_readingValid = false;
+        return;
+    }
+    BME280Manager_temperatureC = BME280Manager_compensateTemperature(adcT);
+    BME280Manager_humidity = BME280Manager_compensateHumidity(adcH);
+    BME280Manager_pressurekPa = BME280Manager_compensatePressure(adcP) / 1000.0;
+    BME280Manager_readingValid = true;
+}
 
 bool BME280Manager_update(void) {
     if (!BME280Manager_enabled || !BME280Manager_initialized) {
         return false;
     }
+    if (BME280Manager_readHandle != I2C_NO_HANDLE) {
+        EI2cStatus status = I2cBus_getStatus(BME280Manager_readHandle);
+        bool inFlight = status == EI2cStatus_I2C_PENDING || status == EI2cStatus_I2C_ACTIVE;
+        if (inFlight) {
+            return false;
+        }
+        if (status == EI2cStatus_I2C_DONE) {
+            BME280Manager_processBurst();
+        } else {
+            BME280Manager_readingValid = false;
+            BME280Manager_errorCount = BME280Manager_errorCount + 1;
+            BME280Manager_lastError = status;
+        }
+        I2cBus_release(BME280Manager_readHandle);
+        BME280Manager_readHandle = I2C_NO_HANDLE;
+        return true;
+    }
     uint32_t now = millis();
     if (now - BME280Manager_lastReadTime < 1000) {
         return false;
     }
-    BME280Manager_temperatureC = BME280Manager_bme.readTemperature();
-    BME280Manager_humidity = BME280Manager_bme.readHumidity();
-    BME280Manager_pressurekPa = BME280Manager_bme.readPressure() / 1000.0;
-    bool tempNan = isnan(BME280Manager_temperatureC);
-    bool humNan = isnan(BME280Manager_humidity);
-    bool presNan = isnan(BME280Manager_pressurekPa);
-    if (tempNan || humNan || presNan) {
-        BME280Manager_readingValid = false;
-        return false;
+    BME280Manager_readHandle = I2cBus_submitRead(BME280Manager_i2cAddress, 0xF7, 8);
+    if (BME280Manager_readHandle != I2C_NO_HANDLE) {
+        BME280Manager_lastReadTime = now;
     }
-    BME280Manager_readingValid = true;
-    BME280Manager_lastReadTime = now;
-    return true;
+    return false;
 }
 
 void BME280Manager_initialize(const AppConfig& config) {
     BME280Manager_enabled = config.bme280Enabled;
+    BME280Manager_readHandle = I2C_NO_HANDLE;
     if (!BME280Manager_enabled) {
         Serial.println("BME280 disabled in config");
         return;
     }
+    I2cBus_flush();
     BME280Manager_i2cAddress = 0x76;
     bool began = BME280Manager_bme.begin(BME280Manager_i2cAddress);
+    bool calibrated = false;
     if (began) {
+        calibrated = BME280Manager_readCalibration();
+    }
+    if (calibrated) {
         BME280Manager_initialized = true;
         BME280Manager_bme.setSampling(3, 1, 1, 1, 0, 5);
         Serial.print("BME280 initialized at 0x");
         Serial.println(BME280Manager_i2cAddress, HEX);
+        BME280Manager_lastReadTime = millis() - 1000;
+        BME280Manager_update();
+        I2cBus_flush();
         BME280Manager_update();
     } else {
         BME280Manager_initialized = false;
@@ -101,3 +254,21 @@ float BME280Manager_getPressurekPa(void) {
 bool BME280Manager_isEnabled(void) {
     return BME280Manager_enabled && BME280Manager_initialized;
 }
+
+uint32_t BME280Manager_getErrorCount(void) {
+    return BME280Manager_errorCount;
+}
+
+void BME280Manager_printDebugInfo(void) {
+    Serial.println("=== BME280 ===");
+    Serial.print("enabled=");
+    Serial.print(BME280Manager_enabled);
+    Serial.print(" init=");
+    Serial.print(BME280Manager_initialized);
+    Serial.print(" valid=");
+    Serial.print(BME280Manager_readingValid);
+    Serial.print(" errors=");
+    Serial.print(BME280Manager_errorCount);
+    Serial.print(" lastError=");
+    Serial.println(static_cast<uint8_t>(BME280Manager_lastError));
+}
@@ -41,16 +41,61 @@ void ConfigStorage_loadDefaults(AppConfig& config) {
         config.tempInputs[i].coeffB = AEM_TEMP_COEFF_B;
         config.tempInputs[i].coeffC = AEM_TEMP_COEFF_C;
         config.tempInputs[i].resistorValue = AEM_TEMP_RESISTOR;
+        config.tempInputs[i].samplePriority = DEFAULT_TEMP_PRIORITY;
+        config.tempInputs[i].dataRate = DEFAULT_TEMP_DATA_RATE;
+        config.tempInputs[i].sampleReserved[0] = 0;
+        config.tempInputs[i].sampleReserved[1] = 0;
     }
     for (uint32_t i = 0; i < PRESSURE_INPUT_COUNT; i += 1) {
         config.pressureInputs[i].assignedValue = EValueId_VALUE_UNASSIGNED;
         config.pressureInputs[i].maxPressure = 100;
         config.pressureInputs[i].pressureType = EPressureType_PRESSURE_TYPE_PSIG;
-        config.pressureInputs[i].reserved = 0;
+        config.pressureInputs[i].samplePriority = DEFAULT_PRESSURE_PRIORITY;
+        config.pressureInputs[i].dataRate = DEFAULT_PRESSURE_DATA_RATE;
     }
     config.egtEnabled = false;
     config.thermocoupleType = EThermocoupleType_TC_TYPE_K;
     config.bme280Enabled = false;
+    for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i += 1) {
+        config.valueFilters[i].filterType = EFilterType_FILTER_NONE;
+        config.valueFilters[i].timeConstantMs = 0;
+        config.valueGlitch[i].medianWindow = 0;
+        config.valueGlitch[i].glitchReserved = 0;
+        config.valueGlitch[i].maxRatePerSec = 0;
+    }
+    for (uint8_t c = 0; c < CURVE_SLOT_COUNT; c += 1) {
+        config.curves[c].inputType = 0;
+        config.curves[c].input = 0;
+        config.curves[c].pointCount = 0;
+        config.curves[c].curveReserved = 0;
+        for (uint8_t p = 0; p < CURVE_POINT_MAX; p += 1) {
+            config.curves[c].points[p].millivolts = 0;
+            config.curves[c].points[p].valueTenths = 0;
+        }
+    }
+    for (uint8_t s = 0; s < STATS_SLOT_COUNT; s += 1) {
+        config.stats[s].valueId = static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED);
+        config.stats[s].statsReserved = 0;
+        config.stats[s].windowSec = 0;
+    }
+    for (uint8_t i = 0; i < SPN_HOLD_COUNT; i += 1) {
+        config.spnHold[i] = static_cast<uint8_t>(ESpnHold_SPN_HOLD_LATEST);
+    }
+    config.pulsation.inputMask = 0;
+    config.pulsation.cylinders = DEFAULT_PULSATION_CYLINDERS;
+    config.pulsation.windowMs = DEFAULT_PULSATION_WINDOW_MS;
+    config.pulsation.pulsationReserved = 0;
+    for (uint8_t a = 0; a < ALARM_SLOT_COUNT; a += 1) {
+        config.alarms[a].valueId = static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED);
+        config.alarms[a].alarmReserved = 0;
+        config.alarms[a].lowTenths = ALARM_NO_LOW;
+        config.alarms[a].highTenths = ALARM_NO_HIGH;
+        config.alarms[a].hysteresisTenths = 0;
+        config.alarms[a].debounceMs = 0;
+    }
+    for (uint8_t g = 0; g < PROCESS_GROUP_COUNT; g += 1) {
+        config.processPeriodMs[g] = DEFAULT_PROCESS_PERIOD_MS;
+    }
     config.checksum = Crc32_calculateChecksum(config);
 }
 
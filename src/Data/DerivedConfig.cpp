@@ -0,0 +1,19 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "DerivedConfig.h"
+
+// Derived Value Configuration Table
+// Virtual EValueIds computed from physical values, mapped to J1939 through
+// SPN_CONFIGS exactly like a sensor-backed value
+#include "types/EValueId.h"
+#include "types/EDerivedOp.h"
+#include "types/TDerivedConfig.h"
+
+#include <stdint.h>
+
+extern const TDerivedConfig DERIVED_CONFIGS[4] = {(TDerivedConfig){ .dest = EValueId_BOOST_PRES, .op = EDerivedOp_DERIVED_DIFF, .a = EValueId_MANIFOLD1_ABS_PRES, .b = EValueId_AMBIENT_PRES, .c = EValueId_VALUE_UNASSIGNED }, (TDerivedConfig){ .dest = EValueId_TURBO1_COMP_PRES_RATIO, .op = EDerivedOp_DERIVED_RATIO, .a = EValueId_TURBO1_COMP_OUTLET_PRES, .b = EValueId_TURBO1_COMP_INLET_PRES, .c = EValueId_VALUE_UNASSIGNED }, (TDerivedConfig){ .dest = EValueId_CAC1_EFFICIENCY, .op = EDerivedOp_DERIVED_EFFECTIVENESS, .a = EValueId_CAC1_INLET_TEMP, .b = EValueId_CAC1_OUTLET_TEMP, .c = EValueId_AMBIENT_TEMP }, (TDerivedConfig){ .dest = EValueId_OIL_COOLANT_TEMP_DELTA, .op = EDerivedOp_DERIVED_DIFF, .a = EValueId_OIL_TEMP, .b = EValueId_COOLANT_TEMP, .c = EValueId_VALUE_UNASSIGNED }};
+
+extern const uint8_t DERIVED_CONFIG_COUNT = 4;
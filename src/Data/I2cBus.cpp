@@ -0,0 +1,471 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "I2cBus.h"
+
+// Non-blocking I2C transaction engine for the sensor bus
+// Drives the Teensy 4 LPI2C1 master (the peripheral behind Wire) from its
+// interrupt: callers queue register reads/writes and poll the returned handle
+// for completion, so the main loop never waits on the bus.
+//
+// Wire.begin()/setClock() still configure the pins, clock and master
+// enable - this engine only feeds the FIFOs.
+#include <Arduino.h>
+#include <Wire.h>
+#include "types/EI2cStatus.h"
+#include <Display/ByteUtils.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ADR-050: Platform-portable IRQ wrappers for critical sections
+#if defined(__arm__) || defined(__ARM_ARCH)
+// ARM platforms (including ARM Arduino like Teensy 4.x, Due, Zero)
+// Provide inline assembly PRIMASK access to avoid CMSIS header dependencies
+__attribute__((always_inline)) static inline uint32_t __cnx_get_PRIMASK(void) {
+    uint32_t result;
+    __asm volatile ("MRS %0, primask" : "=r" (result));
+    return result;
+}
+__attribute__((always_inline)) static inline void __cnx_set_PRIMASK(uint32_t mask) {
+    __asm volatile ("MSR primask, %0" :: "r" (mask) : "memory");
+}
+#if defined(ARDUINO)
+static inline void __cnx_disable_irq(void) { noInterrupts(); }
+#else
+__attribute__((always_inline)) static inline void __cnx_disable_irq(void) {
+    __asm volatile ("cpsid i" ::: "memory");
+}
+#endif
+#elif defined(__AVR__)
+// AVR Arduino: use SREG for interrupt state
+// Note: Uses PRIMASK naming for API consistency across platforms (AVR has no PRIMASK)
+// Returns uint8_t which is implicitly widened to uint32_t at call sites - this is intentional
+static inline uint8_t __cnx_get_PRIMASK(void) { return SREG; }
+static inline void __cnx_set_PRIMASK(uint8_t mask) { SREG = mask; }
+static inline void __cnx_disable_irq(void) { cli(); }
+#else
+// Fallback: assume CMSIS is available
+static inline void __cnx_disable_irq(void) { __disable_irq(); }
+static inline uint32_t __cnx_get_PRIMASK(void) { return __get_PRIMASK(); }
+static inline void __cnx_set_PRIMASK(uint32_t mask) { __set_PRIMASK(mask); }
+#endif
+
+
+// Returned by submit functions when the queue is full
+extern const uint8_t I2C_NO_HANDLE = 0xFF;
+
+/* Scope: I2cBus */
+static uint8_t I2cBus_slotAddress[8] = {0};
+static uint8_t I2cBus_slotRegister[8] = {0};
+static bool I2cBus_slotHasRegister[8] = {0};
+static uint8_t I2cBus_slotWriteLength[8] = {0};
+static uint8_t I2cBus_slotReadLength[8] = {0};
+static uint8_t I2cBus_slotData[8][8] = {0};
+static EI2cStatus I2cBus_slotStatus[8] = {};
+static uint8_t I2cBus_queue[8] = {0};
+static uint8_t I2cBus_queueHead = 0;
+static uint8_t I2cBus_queueCount = 0;
+static uint8_t I2cBus_activeSlot = I2C_NO_HANDLE;
+static uint16_t I2cBus_commandWords[16] = {0};
+static uint8_t I2cBus_commandCount = 0;
+static uint8_t I2cBus_commandsSent = 0;
+static uint8_t I2cBus_bytesReceived = 0;
+static uint32_t I2cBus_activeStartUs = 0;
+static uint32_t I2cBus_completedCount = 0;
+static uint32_t I2cBus_nackCount = 0;
+static uint32_t I2cBus_timeoutCount = 0;
+static uint32_t I2cBus_arbLostCount = 0;
+static uint32_t I2cBus_busErrorCount = 0;
+static uint32_t I2cBus_busClearCount = 0;
+static uint32_t I2cBus_clockHz = 100000;
+
+static void I2cBus_loadCommands(uint8_t slot) {
+    uint16_t addressWrite = static_cast<uint16_t>(I2cBus_slotAddress[slot]) << 1;
+    I2cBus_commandCount = 0;
+    if (I2cBus_slotHasRegister[slot]) {
+        I2cBus_commandWords[0] = 0x0400 | addressWrite;
+        I2cBus_commandWords[1] = 0x0000 | static_cast<uint16_t>(I2cBus_slotRegister[slot]);
+        I2cBus_commandCount = 2;
+        for (uint8_t i = 0; i < I2cBus_slotWriteLength[slot]; i = i + 1) {
+            I2cBus_commandWords[I2cBus_commandCount] = 0x0000 | static_cast<uint16_t>(I2cBus_slotData[slot][i]);
+            I2cBus_commandCount = I2cBus_commandCount + 1;
+        }
+    }
+    if (I2cBus_slotReadLength[slot] > 0) {
+        I2cBus_commandWords[I2cBus_commandCount] = 0x0400 | addressWrite | 1;
+        I2cBus_commandWords[I2cBus_commandCount + 1] = 0x0100 | static_cast<uint16_t>((I2cBus_slotReadLength[slot] - 1));
+        I2cBus_commandCount = I2cBus_commandCount + 2;
+    }
+    I2cBus_commandWords[I2cBus_commandCount] = 0x0200;
+    I2cBus_commandCount = I2cBus_commandCount + 1;
+}
+
+static void I2cBus_startNext(void) {
+    if (I2cBus_queueCount == 0) {
+        return;
+    }
+    uint32_t status = LPI2C1_MSR;
+    if ((status & 0x01000000) != 0) {
+        return;
+    }
+    I2cBus_activeSlot = I2cBus_queue[I2cBus_queueHead];
+    I2cBus_queueHead = (I2cBus_queueHead + 1) % 8;
+    I2cBus_queueCount = I2cBus_queueCount - 1;
+    I2cBus_loadCommands(I2cBus_activeSlot);
+    I2cBus_commandsSent = 0;
+    I2cBus_bytesReceived = 0;
+    I2cBus_activeStartUs = micros();
+    I2cBus_slotStatus[I2cBus_activeSlot] = EI2cStatus_I2C_ACTIVE;
+    LPI2C1_MCR = LPI2C1_MCR | 0x00000300;
+    LPI2C1_MSR = 0x00003F00;
+    LPI2C1_MIER = 0x00003E02 | 0x00000001;
+}
+
+static void I2cBus_finish(EI2cStatus status) {
+    LPI2C1_MIER = 0;
+    I2cBus_slotStatus[I2cBus_activeSlot] = status;
+    I2cBus_activeSlot = I2C_NO_HANDLE;
+}
+
+static void I2cBus_abort(EI2cStatus status) {
+    LPI2C1_MCR = LPI2C1_MCR | 0x00000300;
+    LPI2C1_MTDR = 0x0200;
+    LPI2C1_MSR = 0x00003F00;
+    I2cBus_finish(status);
+}
+
+static void I2cBus_serviceActive(void) {
+    uint32_t status = LPI2C1_MSR;
+    if ((status & 0x00000400) != 0) {
+        I2cBus_nackCount = I2cBus_nackCount + 1;
+        I2cBus_abort(EI2cStatus_I2C_NACK);
+        return;
+    }
+    if ((status & 0x00000800) != 0) {
+        I2cBus_arbLostCount = I2cBus_arbLostCount + 1;
+        I2cBus_abort(EI2cStatus_I2C_ARB_LOST);
+        return;
+    }
+    if ((status & (0x00001000 | 0x00002000)) != 0) {
+        I2cBus_busErrorCount = I2cBus_busErrorCount + 1;
+        I2cBus_abort(EI2cStatus_I2C_BUS_ERROR);
+        return;
+    }
+    uint32_t fifo = LPI2C1_MFSR;
+    uint8_t txCount = ((fifo) & ((1U << 3) - 1));
+    while (txCount < 4 && I2cBus_commandsSent < I2cBus_commandCount) {
+        LPI2C1_MTDR = I2cBus_commandWords[I2cBus_commandsSent];
+        I2cBus_commandsSent = I2cBus_commandsSent + 1;
+        txCount = txCount + 1;
+    }
+    uint8_t rxCount = ((fifo >> 16) & ((1U << 3) - 1));
+    while (rxCount > 0 && I2cBus_bytesReceived < I2cBus_slotReadLength[I2cBus_activeSlot]) {
+        uint32_t word = LPI2C1_MRDR;
+        I2cBus_slotData[I2cBus_activeSlot][I2cBus_bytesReceived] = ((word) & 0xFFU);
+        I2cBus_bytesReceived = I2cBus_bytesReceived + 1;
+        rxCount = rxCount - 1;
+    }
+    bool allSent = I2cBus_commandsSent >= I2cBus_commandCount;
+    bool allReceived = I2cBus_bytesReceived >= I2cBus_slotReadLength[I2cBus_activeSlot];
+    bool stopped = (status & 0x00000200) != 0;
+    if (allSent && stopped) {
+        if (allReceived) {
+            I2cBus_completedCount = I2cBus_completedCount + 1;
+            I2cBus_finish(EI2cStatus_I2C_DONE);
+        } else {
+            I2cBus_busErrorCount = I2cBus_busErrorCount + 1;
+            I2cBus_abort(EI2cStatus_I2C_BUS_ERROR);
+        }
+        return;
+    }
+    if (allSent) {
+        LPI2C1_MIER = 0x00003E02;
+    }
+}
+
+static void I2cBus_busIsr(void) {
+    if (I2cBus_activeSlot != I2C_NO_HANDLE) {
+        I2cBus_serviceActive();
+    }
+    if (I2cBus_activeSlot == I2C_NO_HANDLE) {
+        I2cBus_startNext();
+    }
+}
+
+static uint8_t I2cBus_allocateSlot(void) {
+    for (uint8_t s = 0; s < 8; s = s + 1) {
+        if (I2cBus_slotStatus[s] == EI2cStatus_I2C_FREE) {
+            return s;
+        }
+    }
+    return I2C_NO_HANDLE;
+}
+
+static uint8_t I2cBus_enqueue(uint8_t address, bool hasRegister, uint8_t reg, uint8_t writeLength, uint8_t readLength, uint16_t value) {
+    uint8_t slot = I2C_NO_HANDLE;
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        slot = I2cBus_allocateSlot();
+        if (slot != I2C_NO_HANDLE) {
+            I2cBus_slotAddress[slot] = address;
+            I2cBus_slotRegister[slot] = reg;
+            I2cBus_slotHasRegister[slot] = hasRegister;
+            I2cBus_slotWriteLength[slot] = writeLength;
+            I2cBus_slotReadLength[slot] = readLength;
+            I2cBus_slotData[slot][0] = ByteUtils_highByte(value);
+            I2cBus_slotData[slot][1] = ByteUtils_lowByte(value);
+            I2cBus_slotStatus[slot] = EI2cStatus_I2C_PENDING;
+            I2cBus_queue[(I2cBus_queueHead + I2cBus_queueCount) % 8] = slot;
+            I2cBus_queueCount = I2cBus_queueCount + 1;
+            if (I2cBus_activeSlot == I2C_NO_HANDLE) {
+                I2cBus_startNext();
+            }
+        }
+        __cnx_set_PRIMASK(__primask);
+    }
+    return slot;
+}
+
+void I2cBus_initialize(void) {
+    I2cBus_flush();
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        if (I2cBus_activeSlot != I2C_NO_HANDLE) {
+            I2cBus_abort(EI2cStatus_I2C_TIMEOUT);
+        }
+        for (uint8_t s = 0; s < 8; s = s + 1) {
+            I2cBus_slotStatus[s] = EI2cStatus_I2C_FREE;
+        }
+        I2cBus_queueHead = 0;
+        I2cBus_queueCount = 0;
+        __cnx_set_PRIMASK(__primask);
+    }
+    Wire.begin();
+    I2cBus_clockHz = 100000;
+    attachInterruptVector(IRQ_LPI2C1, I2cBus_busIsr);
+    NVIC_ENABLE_IRQ(IRQ_LPI2C1);
+}
+
+uint8_t I2cBus_submitWrite(uint8_t address, uint8_t reg, uint16_t value) {
+    return I2cBus_enqueue(address, true, reg, 2, 0, value);
+}
+
+uint8_t I2cBus_submitRead(uint8_t address, uint8_t reg, uint8_t length) {
+    if (length == 0 || length > 8) {
+        return I2C_NO_HANDLE;
+    }
+    return I2cBus_enqueue(address, true, reg, 0, length, 0);
+}
+
+uint8_t I2cBus_submitReadCurrent(uint8_t address, uint8_t length) {
+    if (length == 0 || length > 8) {
+        return I2C_NO_HANDLE;
+    }
+    return I2cBus_enqueue(address, false, 0, 0, length, 0);
+}
+
+EI2cStatus I2cBus_getStatus(uint8_t handle) {
+    if (handle >= 8) {
+        return EI2cStatus_I2C_FREE;
+    }
+    EI2cStatus status = EI2cStatus_I2C_FREE;
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        status = I2cBus_slotStatus[handle];
+        __cnx_set_PRIMASK(__primask);
+    }
+    return status;
+}
+
+uint8_t I2cBus_getByte(uint8_t handle, uint8_t index) {
+    if (handle >= 8 || index >= 8) {
+        return 0;
+    }
+    return I2cBus_slotData[handle][index];
+}
+
+void I2cBus_release(uint8_t handle) {
+    if (handle >= 8) {
+        return;
+    }
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        EI2cStatus status = I2cBus_slotStatus[handle];
+        bool inFlight = status == EI2cStatus_I2C_PENDING || status == EI2cStatus_I2C_ACTIVE;
+        if (!inFlight) {
+            I2cBus_slotStatus[handle] = EI2cStatus_I2C_FREE;
+        }
+        __cnx_set_PRIMASK(__primask);
+    }
+}
+
+void I2cBus_service(void) {
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        if (I2cBus_activeSlot != I2C_NO_HANDLE) {
+            uint32_t elapsed = micros() - I2cBus_activeStartUs;
+            if (elapsed > 5000) {
+                I2cBus_timeoutCount = I2cBus_timeoutCount + 1;
+                I2cBus_abort(EI2cStatus_I2C_TIMEOUT);
+            }
+        }
+        if (I2cBus_activeSlot == I2C_NO_HANDLE) {
+            I2cBus_startNext();
+        }
+        __cnx_set_PRIMASK(__primask);
+    }
+}
+
+void I2cBus_setClock(uint32_t hz) {
+    I2cBus_flush();
+    Wire.setClock(hz);
+    I2cBus_clockHz = hz;
+}
+
+bool I2cBus_clearBus(void) {
+    bool idle = false;
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        if (I2cBus_activeSlot != I2C_NO_HANDLE) {
+            uint32_t elapsed = micros() - I2cBus_activeStartUs;
+            if (elapsed > 5000) {
+                I2cBus_timeoutCount = I2cBus_timeoutCount + 1;
+                I2cBus_abort(EI2cStatus_I2C_TIMEOUT);
+            }
+        }
+        idle = I2cBus_activeSlot == I2C_NO_HANDLE;
+        __cnx_set_PRIMASK(__primask);
+    }
+    if (!idle) {
+        return false;
+    }
+    bool stuck = digitalRead(18) == LOW;
+    if (stuck) {
+        delayMicroseconds(5);
+        stuck = digitalRead(18) == LOW;
+    }
+    if (!stuck) {
+        return false;
+    }
+    pinMode(18, INPUT_PULLUP);
+    pinMode(19, OUTPUT_OPENDRAIN);
+    digitalWrite(19, HIGH);
+    delayMicroseconds(5);
+    bool sdaLow = digitalRead(18) == LOW;
+    uint8_t pulses = 0;
+    while (sdaLow && pulses < 9) {
+        digitalWrite(19, LOW);
+        delayMicroseconds(5);
+        digitalWrite(19, HIGH);
+        delayMicroseconds(5);
+        sdaLow = digitalRead(18) == LOW;
+        pulses = pulses + 1;
+    }
+    pinMode(18, OUTPUT_OPENDRAIN);
+    digitalWrite(19, LOW);
+    digitalWrite(18, LOW);
+    delayMicroseconds(5);
+    digitalWrite(19, HIGH);
+    delayMicroseconds(5);
+    digitalWrite(18, HIGH);
+    delayMicroseconds(5);
+    I2cBus_busClearCount = I2cBus_busClearCount + 1;
+    Wire.begin();
+    Wire.setClock(I2cBus_clockHz);
+    attachInterruptVector(IRQ_LPI2C1, I2cBus_busIsr);
+    NVIC_ENABLE_IRQ(IRQ_LPI2C1);
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        if (I2cBus_activeSlot == I2C_NO_HANDLE) {
+            I2cBus_startNext();
+        }
+        __cnx_set_PRIMASK(__primask);
+    }
+    return true;
+}
+
+uint32_t I2cBus_getBusClearCount(void) {
+    return I2cBus_busClearCount;
+}
+
+static bool I2cBus_isBusy(void) {
+    bool busy = false;
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        busy = I2cBus_activeSlot != I2C_NO_HANDLE || I2cBus_queueCount > 0;
+        __cnx_set_PRIMASK(__primask);
+    }
+    return busy;
+}
+
+void I2cBus_flush(void) {
+    uint32_t start = millis();
+    bool busy = I2cBus_isBusy();
+    uint32_t elapsed = 0;
+    while (busy && elapsed < 50) {
+        I2cBus_service();
+        busy = I2cBus_isBusy();
+        elapsed = millis() - start;
+    }
+}
+
+EI2cStatus I2cBus_writeBlocking(uint8_t address, uint8_t reg, uint16_t value) {
+    uint8_t handle = I2cBus_submitWrite(address, reg, value);
+    if (handle == I2C_NO_HANDLE) {
+        return EI2cStatus_I2C_BUS_ERROR;
+    }
+    I2cBus_flush();
+    EI2cStatus status = I2cBus_getStatus(handle);
+    I2cBus_release(handle);
+    return status;
+}
+
+EI2cStatus I2cBus_readBlocking(uint8_t address, uint8_t reg, uint8_t length, uint8_t data[8]) {
+    uint8_t handle = I2cBus_submitRead(address, reg, length);
+    if (handle == I2C_NO_HANDLE) {
+        return EI2cStatus_I2C_BUS_ERROR;
+    }
+    I2cBus_flush();
+    EI2cStatus status = I2cBus_getStatus(handle);
+    for (uint8_t i = 0; i < length; i = i + 1) {
+        data[i] = I2cBus_slotData[handle][i];
+    }
+    I2cBus_release(handle);
+    return status;
+}
+
+void I2cBus_printDebugInfo(void) {
+    uint8_t queued = 0;
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        queued = I2cBus_queueCount;
+        __cnx_set_PRIMASK(__primask);
+    }
+    Serial.println("=== I2C Bus ===");
+    Serial.print("queued=");
+    Serial.print(queued);
+    Serial.print(" done=");
+    Serial.print(I2cBus_completedCount);
+    Serial.print(" nack=");
+    Serial.print(I2cBus_nackCount);
+    Serial.print(" timeout=");
+    Serial.print(I2cBus_timeoutCount);
+    Serial.print(" arbLost=");
+    Serial.print(I2cBus_arbLostCount);
+    Serial.print(" busError=");
+    Serial.print(I2cBus_busErrorCount);
+    Serial.print(" busClear=");
+    Serial.println(I2cBus_busClearCount);
+}
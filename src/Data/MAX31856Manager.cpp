@@ -26,16 +26,25 @@ static bool MAX31856Manager_enabled = false;
 static bool MAX31856Manager_initialized = false;
 static bool MAX31856Manager_conversionStarted = false;
 static uint32_t MAX31856Manager_conversionStartTime = 0;
+static bool MAX31856Manager_drdyReady = false;
+static uint32_t MAX31856Manager_drdyTimestamp = 0;
 static float MAX31856Manager_temperatureC = 0.0;
 static float MAX31856Manager_coldJunctionC = 0.0;
 static uint8_t MAX31856Manager_faultCode = 0;
 static bool MAX31856Manager_readingValid = false;
+static uint32_t MAX31856Manager_readingTimestamp = 0;
+
+static void MAX31856Manager_drdyIsr(void) {
+    MAX31856Manager_drdyTimestamp = micros();
+    MAX31856Manager_drdyReady = true;
+}
 
 static void MAX31856Manager_startConversion(void) {
     if (!MAX31856Manager_enabled || !MAX31856Manager_initialized) {
         MAX31856Manager_conversionStarted = false;
         return;
     }
+    MAX31856Manager_drdyReady = false;
     thermocouple.triggerOneShot();
     MAX31856Manager_conversionStarted = true;
     MAX31856Manager_conversionStartTime = millis();
@@ -45,11 +54,7 @@ static bool MAX31856Manager_isConversionComplete(void) {
     if (!MAX31856Manager_conversionStarted || !MAX31856Manager_enabled || !MAX31856Manager_initialized) {
         return false;
     }
-    int32_t drdyState = digitalRead(2);
-    if (drdyState == LOW) {
-        return true;
-    }
-    return thermocouple.conversionComplete();
+    return MAX31856Manager_drdyReady;
 }
 
 static void MAX31856Manager_readResult(void) {
@@ -62,6 +67,7 @@ static void MAX31856Manager_readResult(void) {
     } else {
         MAX31856Manager_temperatureC = thermocouple.readThermocoupleTemperature();
         MAX31856Manager_coldJunctionC = thermocouple.readCJTemperature();
+        MAX31856Manager_readingTimestamp = MAX31856Manager_drdyTimestamp;
         MAX31856Manager_readingValid = true;
     }
     MAX31856Manager_conversionStarted = false;
@@ -75,12 +81,15 @@ void MAX31856Manager_initialize(const AppConfig& config) {
     }
     pinMode(2, INPUT);
     pinMode(3, INPUT);
+    detachInterrupt(digitalPinToInterrupt(2));
+    MAX31856Manager_drdyReady = false;
     bool began = thermocouple.begin();
     if (began) {
         MAX31856Manager_initialized = true;
         thermocouple.setThermocoupleType(static_cast<uint8_t>(config.thermocoupleType));
         thermocouple.setNoiseFilter(0);
         thermocouple.setConversionMode(0);
+        attachInterrupt(digitalPinToInterrupt(2), MAX31856Manager_drdyIsr, FALLING);
         Serial.println("MAX31856 initialized");
         MAX31856Manager_startConversion();
     } else {
@@ -108,6 +117,7 @@ bool MAX31856Manager_update(void) {
         MAX31856Manager_readingValid = false;
         MAX31856Manager_conversionStarted = false;
         MAX31856Manager_startConversion();
+        return true;
     }
     return false;
 }
@@ -126,6 +136,10 @@ float MAX31856Manager_getColdJunctionC(void) {
     return MAX31856Manager_coldJunctionC;
 }
 
+uint32_t MAX31856Manager_getReadingTimestamp(void) {
+    return MAX31856Manager_readingTimestamp;
+}
+
 bool MAX31856Manager_isEnabled(void) {
     return MAX31856Manager_enabled && MAX31856Manager_initialized;
 }
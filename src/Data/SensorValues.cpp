@@ -7,6 +7,8 @@
 
 // Centralized sensor value storage
 // All values stored in standard units (kPa, °C, %)
+// Inputs converted by the integer path also keep their Q10 value
+// (FixedConvert), which J1939 encodes without float math
 #include "types/EValueId.h"
 
 #include <stdint.h>
@@ -19,5 +21,8 @@ void SensorValues_initialize(void) {
     for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i = i + 1) {
         SensorValues_current[i].value = 0.0;
         SensorValues_current[i].hasHardware = false;
+        SensorValues_current[i].fixedValue = 0;
+        SensorValues_current[i].fixedValid = false;
+        SensorValues_current[i].valid = false;
     }
 }
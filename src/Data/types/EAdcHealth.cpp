@@ -0,0 +1,13 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+// Health of an ADS1115 device's conversion pipeline
+typedef enum {
+    EAdcHealth_ADC_UNUSED = 0,
+    EAdcHealth_ADC_HEALTHY = 1,
+    EAdcHealth_ADC_BACKOFF = 2,
+    EAdcHealth_ADC_PROBING = 3,
+    EAdcHealth_ADC_QUARANTINED = 4
+} EAdcHealth;
@@ -0,0 +1,11 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+// Reported state of a threshold alarm
+typedef enum {
+    EAlarmState_ALARM_NORMAL = 0,
+    EAlarmState_ALARM_LOW = 1,
+    EAlarmState_ALARM_HIGH = 2
+} EAlarmState;
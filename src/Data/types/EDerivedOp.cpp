@@ -0,0 +1,11 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+// Operation that produces a derived value from its source values
+typedef enum {
+    EDerivedOp_DERIVED_DIFF = 0,
+    EDerivedOp_DERIVED_RATIO = 1,
+    EDerivedOp_DERIVED_EFFECTIVENESS = 2
+} EDerivedOp;
@@ -0,0 +1,16 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+// Completion status of a queued I2C bus transaction
+typedef enum {
+    EI2cStatus_I2C_FREE = 0,
+    EI2cStatus_I2C_PENDING = 1,
+    EI2cStatus_I2C_ACTIVE = 2,
+    EI2cStatus_I2C_DONE = 3,
+    EI2cStatus_I2C_NACK = 4,
+    EI2cStatus_I2C_TIMEOUT = 5,
+    EI2cStatus_I2C_ARB_LOST = 6,
+    EI2cStatus_I2C_BUS_ERROR = 7
+} EI2cStatus;
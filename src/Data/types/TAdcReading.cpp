@@ -9,11 +9,15 @@
 /**
  * ADC reading structure used throughout the project.
  * rawValue   - The signed 16-bit result from the ADS1115 conversion.
- * timestamp  - Milliseconds (from millis()) when the conversion completed.
+ * timestamp  - Microseconds (from micros()) captured by the DRDY interrupt
+ *              when the conversion completed.
+ * gain       - ADS1115 PGA code the conversion used (see ADS1115Driver),
+ *              needed to scale rawValue to volts.
  * valid      - Flag indicating whether the reading is fresh/valid.
  */
 typedef struct TAdcReading {
     int16_t rawValue;
     uint32_t timestamp;
+    uint8_t gain;
     bool valid;
 } TAdcReading;
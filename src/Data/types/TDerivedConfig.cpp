@@ -0,0 +1,19 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+// Derived value configuration
+// Maps a virtual EValueId to the operation and source values that produce it
+#include "EValueId.h"
+#include "EDerivedOp.h"
+
+#include <stdint.h>
+
+typedef struct TDerivedConfig {
+    EValueId dest;
+    EDerivedOp op;
+    EValueId a;
+    EValueId b;
+    EValueId c;
+} TDerivedConfig;
@@ -50,15 +50,71 @@ uint32_t Crc32_calculateChecksum(const AppConfig& config) {
         crc = Crc32_crcFloat(crc, config.tempInputs[i].coeffB);
         crc = Crc32_crcFloat(crc, config.tempInputs[i].coeffC);
         crc = Crc32_crcFloat(crc, config.tempInputs[i].resistorValue);
+        crc = Crc32_crcByte(crc, config.tempInputs[i].samplePriority);
+        crc = Crc32_crcByte(crc, config.tempInputs[i].dataRate);
     }
     for (uint32_t i = 0; i < PRESSURE_INPUT_COUNT; i += 1) {
         crc = Crc32_crcByte(crc, static_cast<uint8_t>(config.pressureInputs[i].assignedValue));
         crc = Crc32_crcByte(crc, ((config.pressureInputs[i].maxPressure) & 0xFFU));
         crc = Crc32_crcByte(crc, ((config.pressureInputs[i].maxPressure >> 8) & 0xFFU));
         crc = Crc32_crcByte(crc, config.pressureInputs[i].pressureType);
+        crc = Crc32_crcByte(crc, config.pressureInputs[i].samplePriority);
+        crc = Crc32_crcByte(crc, config.pressureInputs[i].dataRate);
     }
     crc = Crc32_crcByte(crc, config.egtEnabled);
     crc = Crc32_crcByte(crc, config.thermocoupleType);
     crc = Crc32_crcByte(crc, config.bme280Enabled);
+    for (uint32_t i = 0; i < EValueId_VALUE_ID_COUNT; i += 1) {
+        crc = Crc32_crcByte(crc, static_cast<uint8_t>(config.valueFilters[i].filterType));
+        crc = Crc32_crcByte(crc, ((config.valueFilters[i].timeConstantMs) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((config.valueFilters[i].timeConstantMs >> 8) & 0xFFU));
+    }
+    for (uint32_t i = 0; i < EValueId_VALUE_ID_COUNT; i += 1) {
+        crc = Crc32_crcByte(crc, config.valueGlitch[i].medianWindow);
+        crc = Crc32_crcByte(crc, ((config.valueGlitch[i].maxRatePerSec) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((config.valueGlitch[i].maxRatePerSec >> 8) & 0xFFU));
+    }
+    for (uint32_t c = 0; c < CURVE_SLOT_COUNT; c += 1) {
+        crc = Crc32_crcByte(crc, config.curves[c].inputType);
+        crc = Crc32_crcByte(crc, config.curves[c].input);
+        crc = Crc32_crcByte(crc, config.curves[c].pointCount);
+        for (uint32_t p = 0; p < CURVE_POINT_MAX; p += 1) {
+            uint16_t millivolts = config.curves[c].points[p].millivolts;
+            uint16_t valueBits = static_cast<uint16_t>(config.curves[c].points[p].valueTenths);
+            crc = Crc32_crcByte(crc, ((millivolts) & 0xFFU));
+            crc = Crc32_crcByte(crc, ((millivolts >> 8) & 0xFFU));
+            crc = Crc32_crcByte(crc, ((valueBits) & 0xFFU));
+            crc = Crc32_crcByte(crc, ((valueBits >> 8) & 0xFFU));
+        }
+    }
+    for (uint32_t s = 0; s < STATS_SLOT_COUNT; s += 1) {
+        crc = Crc32_crcByte(crc, config.stats[s].valueId);
+        crc = Crc32_crcByte(crc, ((config.stats[s].windowSec) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((config.stats[s].windowSec >> 8) & 0xFFU));
+    }
+    for (uint32_t i = 0; i < SPN_HOLD_COUNT; i += 1) {
+        crc = Crc32_crcByte(crc, config.spnHold[i]);
+    }
+    crc = Crc32_crcByte(crc, config.pulsation.inputMask);
+    crc = Crc32_crcByte(crc, config.pulsation.cylinders);
+    crc = Crc32_crcByte(crc, config.pulsation.windowMs);
+    for (uint32_t a = 0; a < ALARM_SLOT_COUNT; a += 1) {
+        uint16_t lowBits = static_cast<uint16_t>(config.alarms[a].lowTenths);
+        uint16_t highBits = static_cast<uint16_t>(config.alarms[a].highTenths);
+        crc = Crc32_crcByte(crc, config.alarms[a].valueId);
+        crc = Crc32_crcByte(crc, ((lowBits) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((lowBits >> 8) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((highBits) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((highBits >> 8) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((config.alarms[a].hysteresisTenths) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((config.alarms[a].hysteresisTenths >> 8) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((config.alarms[a].debounceMs) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((config.alarms[a].debounceMs >> 8) & 0xFFU));
+    }
+    for (uint32_t g = 0; g < PROCESS_GROUP_COUNT; g += 1) {
+        uint16_t periodMs = config.processPeriodMs[g];
+        crc = Crc32_crcByte(crc, ((periodMs) & 0xFFU));
+        crc = Crc32_crcByte(crc, ((periodMs >> 8) & 0xFFU));
+    }
     return ~crc;
 }
@@ -0,0 +1,65 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "CurveTable.h"
+
+// Calibration Curve Tables
+// User-uploaded voltage -> value breakpoints for sensors that fit neither
+// the linear pressure transfer nor Steinhart-Hart (fuel level senders,
+// non-ratiometric pressure senders). Each curve is compiled into ADC
+// counts and Q10 values when config changes, so the sample path is a
+// bounded binary search (at most 5 steps for 32 points) and one integer
+// interpolation.
+#include "../AppConfig.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Compiled curve, breakpoints in ascending ADC counts
+/* Scope: CurveTable */
+
+bool CurveTable_isValid(const TCurveConfig& curve) {
+    if (curve.pointCount < 2 || curve.pointCount > CURVE_POINT_MAX) {
+        return false;
+    }
+    for (uint8_t i = 1; i < curve.pointCount; i = i + 1) {
+        if (curve.points[i].millivolts <= curve.points[i - 1].millivolts) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CurveTable_build(TCurveTable& table, const TCurveConfig& curve) {
+    table.count = curve.pointCount;
+    for (uint8_t i = 0; i < curve.pointCount; i = i + 1) {
+        table.counts[i] = static_cast<int32_t>(curve.points[i].millivolts) * 128;
+        table.valuesQ10[i] = (static_cast<int32_t>(curve.points[i].valueTenths) * 1024) / 10;
+    }
+}
+
+int32_t CurveTable_lookup(int32_t counts, const TCurveTable& table) {
+    uint8_t last = table.count - 1;
+    if (counts <= table.counts[0]) {
+        return table.valuesQ10[0];
+    }
+    if (counts >= table.counts[last]) {
+        return table.valuesQ10[last];
+    }
+    uint8_t lo = 0;
+    uint8_t hi = last;
+    while (hi - lo > 1) {
+        uint8_t mid = (lo + hi) >> 1;
+        if (table.counts[mid] <= counts) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    int64_t rise = static_cast<int64_t>((table.valuesQ10[hi] - table.valuesQ10[lo]));
+    int64_t run = static_cast<int64_t>((table.counts[hi] - table.counts[lo]));
+    int64_t offset = static_cast<int64_t>((counts - table.counts[lo]));
+    return table.valuesQ10[lo] + static_cast<int32_t>(((offset * rise) / run));
+}
@@ -0,0 +1,89 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "FixedConvert.h"
+
+// Fixed-point Sensor Conversion
+// Integer raw-to-engineering-unit path for the linear (pressure) inputs.
+// Values are Q10 fixed point: 1/1024 kPa or 1/1024 °C per count.
+#include "../AppConfig.h"
+
+#include <stdint.h>
+#include <limits.h>
+
+/* Scope: FixedConvert */
+
+static float FixedConvert_fullScalekPa(const TPressureInputConfig& cfg) {
+    if (cfg.pressureType == EPressureType_PRESSURE_TYPE_PSIA) {
+        if (cfg.maxPressure > 20000) {
+            return static_cast<float>((cfg.maxPressure - 20000)) * 100.0;
+        }
+        return static_cast<float>(cfg.maxPressure);
+    }
+    return static_cast<float>(cfg.maxPressure) * 6.894757;
+}
+
+static int32_t FixedConvert_clampQ10(int64_t value) {
+    if (value > static_cast<int64_t>(0x7FFFFFFF)) {
+        return 0x7FFFFFFF;
+    }
+    if (value < 0) {
+        return 0;
+    }
+    return static_cast<int32_t>(value);
+}
+
+TPressureFixed FixedConvert_pressureCoeffs(const TPressureInputConfig& cfg) {
+    TPressureFixed coeffs = (TPressureFixed){ .zeroCounts = 64000, .ceilingCounts = 64000 + 512000, .multiplier = 0, .gauge = false, .spanQ10 = 0, .interceptQ10 = 0, .fullScaleQ10 = 0 };
+    float perCount = FixedConvert_fullScalekPa(cfg) * 1024.0 * 1048576.0 / static_cast<float>(512000);
+    coeffs.multiplier = ((perCount + 0.5) > ((float)UINT32_MAX) ? UINT32_MAX : (perCount + 0.5) < 0.0f ? 0 : static_cast<uint32_t>((perCount + 0.5)));
+    coeffs.gauge = cfg.pressureType == EPressureType_PRESSURE_TYPE_PSIG;
+    uint64_t spanScaled = (static_cast<uint64_t>(512000) * static_cast<uint64_t>(coeffs.multiplier) + 524288) >> 20;
+    coeffs.spanQ10 = FixedConvert_clampQ10(static_cast<int64_t>(spanScaled));
+    return coeffs;
+}
+
+void FixedConvert_applyAtmospheric(TPressureFixed& coeffs, int32_t atmosphericQ10) {
+    int32_t baro = 0;
+    if (coeffs.gauge) {
+        baro = atmosphericQ10;
+    }
+    coeffs.interceptQ10 = baro;
+    coeffs.fullScaleQ10 = FixedConvert_clampQ10(static_cast<int64_t>(coeffs.spanQ10) + static_cast<int64_t>(baro));
+}
+
+int32_t FixedConvert_pressure(int32_t counts, const TPressureFixed& coeffs) {
+    if (counts < static_cast<int32_t>(coeffs.zeroCounts)) {
+        return 0;
+    }
+    if (counts >= static_cast<int32_t>(coeffs.ceilingCounts)) {
+        return coeffs.fullScaleQ10;
+    }
+    uint64_t scaled = (static_cast<uint64_t>((counts - static_cast<int32_t>(coeffs.zeroCounts))) * static_cast<uint64_t>(coeffs.multiplier) + 524288) >> 20;
+    return FixedConvert_clampQ10(static_cast<int64_t>(scaled) + static_cast<int64_t>(coeffs.interceptQ10));
+}
+
+void FixedConvert_pressureBatch(uint8_t count, const uint8_t slots[7], const int32_t counts[7], const uint32_t multiplier[7], const int32_t intercept[7], const int32_t fullScale[7], int32_t result[7]) {
+    for (uint8_t j = 0; j < count; j = j + 1) {
+        uint8_t k = slots[j];
+        int32_t c = counts[k];
+        int32_t q = 0;
+        if (c >= static_cast<int32_t>((64000 + 512000))) {
+            q = fullScale[k];
+        } else if (c >= static_cast<int32_t>(64000)) {
+            uint64_t scaled = (static_cast<uint64_t>((c - static_cast<int32_t>(64000))) * static_cast<uint64_t>(multiplier[k]) + 524288) >> 20;
+            q = FixedConvert_clampQ10(static_cast<int64_t>(scaled) + static_cast<int64_t>(intercept[k]));
+        }
+        result[k] = q;
+    }
+}
+
+int32_t FixedConvert_fromFloat(float value) {
+    return ((value * 1024.0) > ((float)INT32_MAX) ? INT32_MAX : (value * 1024.0) < ((float)INT32_MIN) ? INT32_MIN : static_cast<int32_t>((value * 1024.0)));
+}
+
+float FixedConvert_toFloat(int32_t value) {
+    return static_cast<float>(value) / 1024.0;
+}
@@ -15,6 +15,17 @@
 const uint8_t InputValid_TEMP_COUNT = 8;
 const uint8_t InputValid_PRESSURE_COUNT = 7;
 const uint8_t InputValid_NTC_PARAM_COUNT = 4;
+const uint8_t InputValid_CURVE_COUNT = 2;
+const uint8_t InputValid_CURVE_POINT_COUNT = 32;
+const uint8_t InputValid_STATS_COUNT = 4;
+const uint16_t InputValid_STATS_WINDOW_MAX = 1800;
+const uint8_t InputValid_CYLINDER_MAX = 16;
+const uint8_t InputValid_PULSATION_WINDOW_MAX = 250;
+const uint8_t InputValid_ALARM_COUNT = 8;
+const uint16_t InputValid_ALARM_DEBOUNCE_MAX_MS = 10000;
+const uint8_t InputValid_PROCESS_GROUP_COUNT = 4;
+const uint16_t InputValid_PROCESS_PERIOD_MIN_MS = 5;
+const uint16_t InputValid_PROCESS_PERIOD_MAX_MS = 10000;
 
 bool InputValid_isValidTempInput(uint8_t input) {
     if (input < 1) {
@@ -140,3 +151,144 @@ bool InputValid_isValidAdsChannel(uint8_t channel) {
     }
     return true;
 }
+
+bool InputValid_isValidSamplePriority(uint8_t priority) {
+    if (priority < 1) {
+        return false;
+    }
+    if (priority > 8) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidAdsDataRate(uint8_t rate) {
+    if (rate > 7) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidFilterType(uint8_t filterType) {
+    if (filterType > 2) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidMedianWindow(uint8_t window) {
+    if (window == 0 || window == 3 || window == 5) {
+        return true;
+    }
+    return false;
+}
+
+bool InputValid_isValidCurve(uint8_t curve) {
+    if (curve < 1) {
+        return false;
+    }
+    if (curve > InputValid_CURVE_COUNT) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidCurvePoint(uint8_t point) {
+    if (point >= InputValid_CURVE_POINT_COUNT) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidStatsSlot(uint8_t slot) {
+    if (slot < 1) {
+        return false;
+    }
+    if (slot > InputValid_STATS_COUNT) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidStatsWindow(uint16_t windowSec) {
+    if (windowSec < 1) {
+        return false;
+    }
+    if (windowSec > InputValid_STATS_WINDOW_MAX) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidHoldMode(uint8_t holdMode) {
+    if (holdMode > 2) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidCylinderCount(uint8_t cylinders) {
+    if (cylinders < 1) {
+        return false;
+    }
+    if (cylinders > InputValid_CYLINDER_MAX) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidPulsationWindow(uint8_t windowMs) {
+    if (windowMs < 1) {
+        return false;
+    }
+    if (windowMs > InputValid_PULSATION_WINDOW_MAX) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidAlarmSlot(uint8_t slot) {
+    if (slot < 1) {
+        return false;
+    }
+    if (slot > InputValid_ALARM_COUNT) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidAlarmLimits(int16_t lowTenths, int16_t highTenths, uint16_t hysteresisTenths) {
+    bool hasLow = lowTenths != -32768;
+    bool hasHigh = highTenths != 32767;
+    if (!hasLow && !hasHigh) {
+        return false;
+    }
+    if (hasLow && hasHigh && static_cast<int32_t>(highTenths) - static_cast<int32_t>(lowTenths) <= static_cast<int32_t>(hysteresisTenths)) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidAlarmDebounce(uint16_t debounceMs) {
+    if (debounceMs > InputValid_ALARM_DEBOUNCE_MAX_MS) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidProcessGroup(uint8_t group) {
+    if (group >= InputValid_PROCESS_GROUP_COUNT) {
+        return false;
+    }
+    return true;
+}
+
+bool InputValid_isValidProcessPeriod(uint16_t periodMs) {
+    if (periodMs < InputValid_PROCESS_PERIOD_MIN_MS) {
+        return false;
+    }
+    if (periodMs > InputValid_PROCESS_PERIOD_MAX_MS) {
+        return false;
+    }
+    return true;
+}
@@ -12,8 +12,10 @@
 #include "FlexCAN_T4.h"
 #include <J1939Message.h>
 #include "J1939Encode.h"
+#include "FixedConvert.h"
 #include <Data/J1939Config.h>
 #include <Data/SensorValues.h>
+#include "SpnHold.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -55,6 +57,11 @@ static inline void __cnx_set_PRIMASK(uint32_t mask) { __set_PRIMASK(mask); }
 static FlexCAN_T4<CAN1,RX_SIZE_256,TX_SIZE_16> J1939Bus_canBus = {};
 static bool J1939Bus_configCmdPending = false;
 static uint8_t J1939Bus_configCmdData[8] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+static uint8_t J1939Bus_spnFixedShift[24] = {0};
+static int32_t J1939Bus_spnFixedOffset[24] = {0};
+static uint32_t J1939Bus_rxLatencyMaxUs = 0;
+static uint16_t J1939Bus_engineSpeedRaw = 0xFFFF;
+static uint32_t J1939Bus_engineSpeedMs = 0;
 
 static uint32_t J1939Bus_buildCanId(uint16_t pgn, uint8_t priority, uint8_t sourceAddr) {
     uint32_t id = 0;
@@ -85,7 +92,7 @@ void J1939Bus_sendMessage(uint16_t pgn, const uint8_t buf[8]) {
     J1939Bus_canBus.write(msg);
 }
 
-void J1939Bus_sendPgnGeneric(uint16_t pgn) {
+static void J1939Bus_sendPgn(uint16_t pgn, bool consumeHold) {
     uint8_t buf[8] = {0};
     J1939Bus_fillBuffer(buf);
     for (uint8_t i = 0; i < SPN_CONFIG_COUNT; i = i + 1) {
@@ -97,8 +104,19 @@ void J1939Bus_sendPgnGeneric(uint16_t pgn) {
         if (!hasHw) {
             continue;
         }
-        float value = SensorValues_current[cfg.source].value;
-        uint16_t encoded = J1939Encode_encode(value, cfg.resolution, cfg.offset);
+        TSensorValue sample = SensorValues_current[cfg.source];
+        if (consumeHold) {
+            SpnHold_take(i, sample);
+        } else {
+            SpnHold_peek(i, sample);
+        }
+        uint16_t encoded = 0;
+        bool useFixed = sample.fixedValid && J1939Bus_spnFixedShift[i] != J1939Encode_FIXED_SHIFT_NONE;
+        if (useFixed) {
+            encoded = J1939Encode_encodeFixed(sample.fixedValue, J1939Bus_spnFixedOffset[i], J1939Bus_spnFixedShift[i]);
+        } else {
+            encoded = J1939Encode_encode(sample.value, cfg.resolution, cfg.offset);
+        }
         uint8_t pos = cfg.bytePos - 1;
         buf[pos] = static_cast<uint8_t>((encoded & 0xFF));
         if (cfg.dataLength == 2) {
@@ -108,6 +126,14 @@ void J1939Bus_sendPgnGeneric(uint16_t pgn) {
     J1939Bus_sendMessage(pgn, buf);
 }
 
+void J1939Bus_sendPgnGeneric(uint16_t pgn) {
+    J1939Bus_sendPgn(pgn, true);
+}
+
+void J1939Bus_sendPgnKeepHold(uint16_t pgn) {
+    J1939Bus_sendPgn(pgn, false);
+}
+
 bool J1939Bus_hasPendingCommand(void) {
     return J1939Bus_configCmdPending;
 }
@@ -125,6 +151,11 @@ void J1939Bus_getPendingCommand(uint8_t outData[8]) {
 }
 
 static void J1939Bus_sniffDataPrivateISR(const CAN_message_t& msg) {
+    uint16_t ticks = static_cast<uint16_t>((static_cast<uint16_t>(CAN1_TIMER) - msg.timestamp));
+    uint32_t latencyUs = static_cast<uint32_t>(ticks) * 4;
+    if (latencyUs > J1939Bus_rxLatencyMaxUs) {
+        J1939Bus_rxLatencyMaxUs = latencyUs;
+    }
     J1939Message message = {};
     message.pgn = 0;
     message.setCanId(msg.id);
@@ -136,13 +167,46 @@ static void J1939Bus_sniffDataPrivateISR(const CAN_message_t& msg) {
         J1939Bus_configCmdPending = true;
         return;
     }
+    if (message.pgn == 61444) {
+        J1939Bus_engineSpeedRaw = (static_cast<uint16_t>(msg.buf[4]) << 8) | static_cast<uint16_t>(msg.buf[3]);
+        J1939Bus_engineSpeedMs = millis();
+        return;
+    }
     if (message.pgn == 59904) {
         J1939Bus_canBus.write(msg);
     }
 }
 
+uint32_t J1939Bus_getRxLatencyMaxUs(void) {
+    return J1939Bus_rxLatencyMaxUs;
+}
+
+void J1939Bus_resetRxLatencyMax(void) {
+    J1939Bus_rxLatencyMaxUs = 0;
+}
+
+float J1939Bus_getEngineRpm(void) {
+    uint16_t raw = 0xFFFF;
+    uint32_t receivedMs = 0;
+    {
+        uint32_t __primask = __cnx_get_PRIMASK();
+        __cnx_disable_irq();
+        raw = J1939Bus_engineSpeedRaw;
+        receivedMs = J1939Bus_engineSpeedMs;
+        __cnx_set_PRIMASK(__primask);
+    }
+    if (raw > 0xFAFF || millis() - receivedMs > 500) {
+        return 0.0;
+    }
+    return static_cast<float>(raw) * 0.125;
+}
+
 void J1939Bus_initialize(void) {
     Serial.println("J1939 Bus initializing");
+    for (uint8_t i = 0; i < SPN_CONFIG_COUNT; i = i + 1) {
+        J1939Bus_spnFixedShift[i] = J1939Encode_fixedShift(SPN_CONFIGS[i].resolution);
+        J1939Bus_spnFixedOffset[i] = FixedConvert_fromFloat(SPN_CONFIGS[i].offset);
+    }
     J1939Bus_canBus.begin();
     J1939Bus_canBus.setBaudRate(250000);
     J1939Bus_canBus.setMaxMB(16);
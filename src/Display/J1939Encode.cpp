@@ -11,12 +11,36 @@
 // J1939 SPN Encoding Functions
 // Converts sensor values to J1939 protocol format per SAE J1939-71
 /* Scope: J1939Encode */
+const uint8_t J1939Encode_FIXED_SHIFT_NONE = 0xFF;
 
 uint16_t J1939Encode_encode(float value, float resolution, float offset) {
     float scaled = (value + offset) / resolution;
     return ((scaled) > ((float)UINT16_MAX) ? UINT16_MAX : (scaled) < 0.0f ? 0 : static_cast<uint16_t>((scaled)));
 }
 
+uint8_t J1939Encode_fixedShift(float resolution) {
+    uint8_t shift = J1939Encode_FIXED_SHIFT_NONE;
+    for (uint8_t s = 0; s < 16; s = s + 1) {
+        float step = static_cast<float>((static_cast<uint32_t>(1) << s)) / 1024.0;
+        if (step == resolution) {
+            shift = s;
+        }
+    }
+    return shift;
+}
+
+uint16_t J1939Encode_encodeFixed(int32_t valueQ10, int32_t offsetQ10, uint8_t shift) {
+    int32_t biased = valueQ10 + offsetQ10;
+    if (biased < 0) {
+        return 0;
+    }
+    uint32_t counts = static_cast<uint32_t>(biased) >> shift;
+    if (counts > 0xFFFF) {
+        return 0xFFFF;
+    }
+    return static_cast<uint16_t>(counts);
+}
+
 uint16_t J1939Encode_temp16bit(float temperatureC) {
     float offset = temperatureC + 273.0;
     float scaled = offset / 0.03125;
@@ -0,0 +1,82 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "NtcTable.h"
+
+// NTC Lookup Tables
+// Per-input ADC count -> temperature tables, built from the Steinhart-Hart
+// coefficients whenever config changes so the sample path needs no log().
+// Breakpoints are uniform in temperature (every 2°C from -50°C to 206°C) and
+// hold the normalized ADC counts the divider produces at that temperature.
+// Linear interpolation between breakpoints stays within 0.05°C of the
+// Steinhart-Hart result for the built-in presets.
+#include <math.h>
+#include "../AppConfig.h"
+
+#include <stdint.h>
+#include <limits.h>
+
+// One table per temperature input, counts fall as temperature rises
+/* Scope: NtcTable */
+
+const int32_t NtcTable_ERROR_Q10 = -279706;
+
+static float NtcTable_logResistance(float tempC, const TTempInputConfig& cfg) {
+    float invT = 1.0 / (tempC + 273.15);
+    if (cfg.coeffC == 0.0) {
+        return (invT - cfg.coeffA) / cfg.coeffB;
+    }
+    float x = (cfg.coeffA - invT) / cfg.coeffC;
+    float b3 = cfg.coeffB / (3.0 * cfg.coeffC);
+    float y = sqrt(b3 * b3 * b3 + x * x / 4.0);
+    return cbrt(y - x / 2.0) - cbrt(y + x / 2.0);
+}
+
+void NtcTable_build(TNtcTable& table, const TTempInputConfig& cfg) {
+    for (uint8_t i = 0; i <= 128; i = i + 1) {
+        float tempC = static_cast<float>((-50 + static_cast<int32_t>(i) * 2));
+        float r = exp(NtcTable_logResistance(tempC, cfg));
+        float counts = static_cast<float>(640000) * r / (cfg.resistorValue + r);
+        table.counts[i] = ((counts + 0.5) > ((float)INT32_MAX) ? INT32_MAX : (counts + 0.5) < ((float)INT32_MIN) ? INT32_MIN : static_cast<int32_t>((counts + 0.5)));
+    }
+}
+
+int32_t NtcTable_lookup(int32_t counts, const TNtcTable& table) {
+    if (counts <= 0) {
+        return NtcTable_ERROR_Q10;
+    }
+    if (counts >= 640000) {
+        return NtcTable_ERROR_Q10;
+    }
+    if (counts >= table.counts[0]) {
+        return -50 * 1024;
+    }
+    if (counts <= table.counts[128]) {
+        return (-50 + static_cast<int32_t>(128) * 2) * 1024;
+    }
+    uint8_t lo = 0;
+    uint8_t step = 64;
+    for (uint8_t s = 0; s < 7; s = s + 1) {
+        uint8_t probe = lo + step;
+        if (table.counts[probe] >= counts) {
+            lo = probe;
+        }
+        step = step >> 1;
+    }
+    int32_t base = (-50 + static_cast<int32_t>(lo) * 2) * 1024;
+    int32_t width = table.counts[lo] - table.counts[lo + 1];
+    if (width <= 0) {
+        return base;
+    }
+    int32_t fraction = ((table.counts[lo] - counts) * (2 * 1024)) / width;
+    return base + fraction;
+}
+
+void NtcTable_lookupBatch(uint8_t count, const uint8_t slots[8], const int32_t counts[8], const TNtcTable tables[8], int32_t result[8]) {
+    for (uint8_t j = 0; j < count; j = j + 1) {
+        uint8_t k = slots[j];
+        result[k] = NtcTable_lookup(counts[k], tables[k]);
+    }
+}
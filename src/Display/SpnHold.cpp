@@ -0,0 +1,90 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "SpnHold.h"
+
+// SPN Hold
+// Per-SPN peak or valley capture between J1939 broadcasts. A value that
+// moves faster than its PGN rate (fuel pressure dips, boost spikes) would
+// otherwise only show whatever sample happened to be latest at send time.
+// SensorProcessor captures every published sample; J1939Bus takes the held
+// sample when it encodes the SPN, which restarts the hold for that SPN.
+#include <AppConfig.h>
+#include <Data/J1939Config.h>
+#include <Data/SensorValues.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Scope: SpnHold */
+static uint32_t SpnHold_holdMask[EValueId_VALUE_ID_COUNT] = {0};
+static uint8_t SpnHold_mode[24] = {0};
+static TSensorValue SpnHold_held[24] = {0};
+static bool SpnHold_pending[24] = {0};
+
+void SpnHold_configure(const AppConfig& config) {
+    for (uint8_t v = 0; v < EValueId_VALUE_ID_COUNT; v += 1) {
+        SpnHold_holdMask[v] = 0;
+    }
+    for (uint8_t i = 0; i < SPN_CONFIG_COUNT; i += 1) {
+        SpnHold_mode[i] = static_cast<uint8_t>(ESpnHold_SPN_HOLD_LATEST);
+        SpnHold_pending[i] = false;
+        uint8_t m = config.spnHold[i];
+        EValueId source = SPN_CONFIGS[i].source;
+        if ((m == static_cast<uint8_t>(ESpnHold_SPN_HOLD_MAX) || m == static_cast<uint8_t>(ESpnHold_SPN_HOLD_MIN)) && source < EValueId_VALUE_ID_COUNT) {
+            SpnHold_mode[i] = m;
+            SpnHold_holdMask[source] = SpnHold_holdMask[source] | (static_cast<uint32_t>(1) << i);
+        }
+    }
+}
+
+uint8_t SpnHold_select(AppConfig& config, EValueId id, uint16_t spn, ESpnHold hold) {
+    uint8_t matched = 0;
+    for (uint8_t i = 0; i < SPN_CONFIG_COUNT; i += 1) {
+        if (SPN_CONFIGS[i].source == id && (spn == 0xFFFF || SPN_CONFIGS[i].spn == spn)) {
+            config.spnHold[i] = static_cast<uint8_t>(hold);
+            matched = matched + 1;
+        }
+    }
+    return matched;
+}
+
+void SpnHold_capture(EValueId id, bool valid) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return;
+    }
+    uint32_t mask = SpnHold_holdMask[id];
+    uint8_t i = 0;
+    while (mask != 0) {
+        if ((mask & 1) != 0) {
+            if (!valid) {
+                SpnHold_pending[i] = false;
+            } else if (!SpnHold_pending[i]) {
+                SpnHold_held[i] = SensorValues_current[id];
+                SpnHold_pending[i] = true;
+            } else if (SpnHold_mode[i] == static_cast<uint8_t>(ESpnHold_SPN_HOLD_MAX) && SensorValues_current[id].value > SpnHold_held[i].value) {
+                SpnHold_held[i] = SensorValues_current[id];
+            } else if (SpnHold_mode[i] == static_cast<uint8_t>(ESpnHold_SPN_HOLD_MIN) && SensorValues_current[id].value < SpnHold_held[i].value) {
+                SpnHold_held[i] = SensorValues_current[id];
+            }
+        }
+        mask = mask >> 1;
+        i = i + 1;
+    }
+}
+
+void SpnHold_take(uint8_t index, TSensorValue& sample) {
+    if (!SpnHold_pending[index]) {
+        return;
+    }
+    sample = SpnHold_held[index];
+    SpnHold_pending[index] = false;
+}
+
+void SpnHold_peek(uint8_t index, TSensorValue& sample) {
+    if (SpnHold_pending[index]) {
+        sample = SpnHold_held[index];
+    }
+}
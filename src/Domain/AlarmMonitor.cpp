@@ -0,0 +1,214 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "AlarmMonitor.h"
+
+// Alarm Monitor
+// Local threshold alarms on up to ALARM_SLOT_COUNT values, checked by
+// SensorProcessor as each sample is published. A limit crossing must
+// persist for the slot's debounce time before the alarm state changes,
+// and an active alarm only clears once the value is back inside its limit
+// by the hysteresis. Changes are sent at the end of the processing tick
+// that confirmed them, ahead of the 500ms/1s PGN schedule: every PGN
+// carrying the value goes out at once, then an alert frame on PGN 65283.
+// Latency is measured from the confirming sample's timestamp to the alert
+// frame reaching the CAN controller.
+#include <Arduino.h>
+#include <AppConfig.h>
+#include <Data/J1939Config.h>
+#include <Data/types/EAlarmState.h>
+#include <Display/J1939Bus.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Limits and state for one alarm slot
+/* Scope: AlarmMonitor */
+static TAlarmSlot AlarmMonitor_slots[8] = {0};
+static uint8_t AlarmMonitor_slotOf[EValueId_VALUE_ID_COUNT] = {0};
+static bool AlarmMonitor_anyPending = false;
+static uint32_t AlarmMonitor_latencyMaxUs = 0;
+
+static uint16_t AlarmMonitor_pgnMaskFor(uint8_t id) {
+    uint16_t mask = 0;
+    for (uint8_t i = 0; i < SPN_CONFIG_COUNT; i += 1) {
+        if (static_cast<uint8_t>(SPN_CONFIGS[i].source) == id) {
+            for (uint8_t p = 0; p < PGN_CONFIG_COUNT; p += 1) {
+                if (PGN_CONFIGS[p].pgn == SPN_CONFIGS[i].pgn) {
+                    mask = mask | static_cast<uint16_t>((1 << p));
+                }
+            }
+        }
+    }
+    return mask;
+}
+
+static EAlarmState AlarmMonitor_classify(uint8_t s, float value) {
+    if (AlarmMonitor_slots[s].lowEnabled && value < AlarmMonitor_slots[s].low) {
+        return EAlarmState_ALARM_LOW;
+    }
+    if (AlarmMonitor_slots[s].highEnabled && value > AlarmMonitor_slots[s].high) {
+        return EAlarmState_ALARM_HIGH;
+    }
+    if (AlarmMonitor_slots[s].state == EAlarmState_ALARM_LOW && value < AlarmMonitor_slots[s].low + AlarmMonitor_slots[s].hysteresis) {
+        return EAlarmState_ALARM_LOW;
+    }
+    if (AlarmMonitor_slots[s].state == EAlarmState_ALARM_HIGH && value > AlarmMonitor_slots[s].high - AlarmMonitor_slots[s].hysteresis) {
+        return EAlarmState_ALARM_HIGH;
+    }
+    return EAlarmState_ALARM_NORMAL;
+}
+
+static uint8_t AlarmMonitor_activeMask(void) {
+    uint8_t mask = 0;
+    for (uint8_t s = 0; s < ALARM_SLOT_COUNT; s += 1) {
+        if (AlarmMonitor_slots[s].state != EAlarmState_ALARM_NORMAL) {
+            mask = mask | static_cast<uint8_t>((1 << s));
+        }
+    }
+    return mask;
+}
+
+static void AlarmMonitor_sendAlert(uint8_t s) {
+    float scaled = AlarmMonitor_slots[s].eventValue * 10.0;
+    if (scaled > 32767.0) {
+        scaled = 32767.0;
+    }
+    if (scaled < -32767.0) {
+        scaled = -32767.0;
+    }
+    int16_t tenths = static_cast<int16_t>(scaled);
+    uint16_t valueRaw = static_cast<uint16_t>(tenths);
+    uint32_t latencyUs = micros() - AlarmMonitor_slots[s].eventUs;
+    if (latencyUs > AlarmMonitor_latencyMaxUs) {
+        AlarmMonitor_latencyMaxUs = latencyUs;
+    }
+    uint32_t latencyRaw = latencyUs / 100;
+    if (latencyRaw > 0xFAFF) {
+        latencyRaw = 0xFAFF;
+    }
+    uint8_t buf[8] = {0};
+    buf[0] = s + 1;
+    buf[1] = AlarmMonitor_slots[s].valueId;
+    buf[2] = static_cast<uint8_t>(AlarmMonitor_slots[s].state);
+    buf[3] = static_cast<uint8_t>((valueRaw & 0xFF));
+    buf[4] = static_cast<uint8_t>((valueRaw >> 8));
+    buf[5] = static_cast<uint8_t>((latencyRaw & 0xFF));
+    buf[6] = static_cast<uint8_t>((latencyRaw >> 8));
+    buf[7] = AlarmMonitor_activeMask();
+    J1939Bus_sendMessage(65283, buf);
+}
+
+void AlarmMonitor_configure(const AppConfig& config) {
+    for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i += 1) {
+        AlarmMonitor_slotOf[i] = ALARM_SLOT_COUNT;
+    }
+    AlarmMonitor_anyPending = false;
+    for (uint8_t s = 0; s < ALARM_SLOT_COUNT; s += 1) {
+        uint8_t id = config.alarms[s].valueId;
+        bool lowEnabled = config.alarms[s].lowTenths != ALARM_NO_LOW;
+        bool highEnabled = config.alarms[s].highTenths != ALARM_NO_HIGH;
+        float low = static_cast<float>(config.alarms[s].lowTenths) / 10.0;
+        float high = static_cast<float>(config.alarms[s].highTenths) / 10.0;
+        uint8_t watched = static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED);
+        bool hasLimit = lowEnabled || highEnabled;
+        if (id < EValueId_VALUE_ID_COUNT && hasLimit && AlarmMonitor_slotOf[id] == ALARM_SLOT_COUNT) {
+            AlarmMonitor_slotOf[id] = s;
+            watched = id;
+        }
+        bool unchanged = watched != static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED)
+            && AlarmMonitor_slots[s].valueId == watched
+            && AlarmMonitor_slots[s].lowEnabled == lowEnabled && AlarmMonitor_slots[s].highEnabled == highEnabled
+            && AlarmMonitor_slots[s].low == low && AlarmMonitor_slots[s].high == high;
+        AlarmMonitor_slots[s].valueId = watched;
+        AlarmMonitor_slots[s].lowEnabled = lowEnabled;
+        AlarmMonitor_slots[s].highEnabled = highEnabled;
+        AlarmMonitor_slots[s].low = low;
+        AlarmMonitor_slots[s].high = high;
+        AlarmMonitor_slots[s].hysteresis = static_cast<float>(config.alarms[s].hysteresisTenths) / 10.0;
+        AlarmMonitor_slots[s].debounceUs = static_cast<uint32_t>(config.alarms[s].debounceMs) * 1000;
+        AlarmMonitor_slots[s].pgnMask = 0;
+        if (watched != static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED)) {
+            AlarmMonitor_slots[s].pgnMask = AlarmMonitor_pgnMaskFor(watched);
+        }
+        if (unchanged) {
+            AlarmMonitor_anyPending = AlarmMonitor_anyPending || AlarmMonitor_slots[s].eventPending;
+        } else {
+            AlarmMonitor_slots[s].state = EAlarmState_ALARM_NORMAL;
+            AlarmMonitor_slots[s].candidate = EAlarmState_ALARM_NORMAL;
+            AlarmMonitor_slots[s].eventPending = false;
+        }
+    }
+}
+
+void AlarmMonitor_check(EValueId id, float value, bool valid, uint32_t timestampUs) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return;
+    }
+    uint8_t s = AlarmMonitor_slotOf[id];
+    if (s >= ALARM_SLOT_COUNT) {
+        return;
+    }
+    if (!valid) {
+        AlarmMonitor_slots[s].candidate = AlarmMonitor_slots[s].state;
+        return;
+    }
+    EAlarmState next = AlarmMonitor_classify(s, value);
+    if (next == AlarmMonitor_slots[s].state) {
+        AlarmMonitor_slots[s].candidate = next;
+        return;
+    }
+    if (next != AlarmMonitor_slots[s].candidate) {
+        AlarmMonitor_slots[s].candidate = next;
+        AlarmMonitor_slots[s].candidateSinceUs = timestampUs;
+    }
+    if (timestampUs - AlarmMonitor_slots[s].candidateSinceUs < AlarmMonitor_slots[s].debounceUs) {
+        return;
+    }
+    AlarmMonitor_slots[s].state = next;
+    AlarmMonitor_slots[s].eventPending = true;
+    AlarmMonitor_slots[s].eventValue = value;
+    AlarmMonitor_slots[s].eventUs = timestampUs;
+    AlarmMonitor_anyPending = true;
+}
+
+void AlarmMonitor_flush(void) {
+    if (!AlarmMonitor_anyPending) {
+        return;
+    }
+    AlarmMonitor_anyPending = false;
+    uint16_t pgnMask = 0;
+    for (uint8_t s = 0; s < ALARM_SLOT_COUNT; s += 1) {
+        if (AlarmMonitor_slots[s].eventPending) {
+            pgnMask = pgnMask | AlarmMonitor_slots[s].pgnMask;
+        }
+    }
+    for (uint8_t p = 0; p < PGN_CONFIG_COUNT; p += 1) {
+        if (((pgnMask >> p) & 1) != 0) {
+            J1939Bus_sendPgnKeepHold(PGN_CONFIGS[p].pgn);
+        }
+    }
+    for (uint8_t s = 0; s < ALARM_SLOT_COUNT; s += 1) {
+        if (AlarmMonitor_slots[s].eventPending) {
+            AlarmMonitor_slots[s].eventPending = false;
+            AlarmMonitor_sendAlert(s);
+        }
+    }
+}
+
+EAlarmState AlarmMonitor_getState(uint8_t slot) {
+    if (slot >= ALARM_SLOT_COUNT) {
+        return EAlarmState_ALARM_NORMAL;
+    }
+    return AlarmMonitor_slots[slot].state;
+}
+
+uint32_t AlarmMonitor_getLatencyMaxUs(void) {
+    return AlarmMonitor_latencyMaxUs;
+}
+
+void AlarmMonitor_resetLatencyMax(void) {
+    AlarmMonitor_latencyMaxUs = 0;
+}
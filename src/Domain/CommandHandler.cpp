@@ -11,6 +11,14 @@
 #include <AppConfig.h>
 #include <Data/ConfigStorage.h>
 #include <Domain/Hardware.h>
+#include <Domain/SensorProcessor.h>
+#include <Domain/GlitchFilter.h>
+#include <Domain/SignalFilter.h>
+#include <Domain/DerivedValues.h>
+#include <Domain/RollingStats.h>
+#include <Domain/AlarmMonitor.h>
+#include <Display/SpnHold.h>
+#include <Display/CurveTable.h>
 #include <Display/Presets.h>
 #include <Display/InputValid.h>
 
@@ -18,6 +26,8 @@
 #include <stdbool.h>
 
 /* Scope: CommandHandler */
+static TCurvePoint CommandHandler_stagedPoints[2][32] = {0};
+static bool CommandHandler_staging[2] = {0};
 
 EValueCategory CommandHandler_getValueCategory(EValueId valueId) {
     switch (valueId) {
@@ -211,6 +221,7 @@ static ECommandResult CommandHandler_setPressureRange(const uint8_t data[8]) {
     }
     uint16_t maxPressure = (static_cast<uint16_t>(data[2]) << 8) | static_cast<uint16_t>(data[3]);
     appConfig.pressureInputs[data[1] - 1].maxPressure = maxPressure;
+    SensorProcessor_reloadCalibration(appConfig);
     ConfigStorage_saveConfig(appConfig);
     return ECommandResult_CMD_SUCCESS;
 }
@@ -239,6 +250,7 @@ static ECommandResult CommandHandler_applyNtcPreset(const uint8_t data[8]) {
     appConfig.tempInputs[idx].coeffB = Presets_ntcCoeffB(data[2]);
     appConfig.tempInputs[idx].coeffC = Presets_ntcCoeffC(data[2]);
     appConfig.tempInputs[idx].resistorValue = Presets_ntcResistor(data[2]);
+    SensorProcessor_reloadCalibration(appConfig);
     ConfigStorage_saveConfig(appConfig);
     return ECommandResult_CMD_SUCCESS;
 }
@@ -261,6 +273,325 @@ static ECommandResult CommandHandler_applyPressurePreset(const uint8_t data[8])
         appConfig.pressureInputs[idx].maxPressure = Presets_psiPresetValue(data[2]);
         appConfig.pressureInputs[idx].pressureType = EPressureType_PRESSURE_TYPE_PSIG;
     }
+    SensorProcessor_reloadCalibration(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setSampling(const uint8_t data[8]) {
+    bool validPriority = InputValid_isValidSamplePriority(data[3]);
+    if (!validPriority) {
+        return ECommandResult_CMD_INVALID_PRIORITY;
+    }
+    bool validRate = InputValid_isValidAdsDataRate(data[4]);
+    if (!validRate) {
+        return ECommandResult_CMD_INVALID_DATA_RATE;
+    }
+    switch (data[1]) {
+        case 0: {
+            bool validInput = InputValid_isValidTempInput(data[2]);
+            if (!validInput) {
+                return ECommandResult_CMD_INVALID_SENSOR_NUMBER;
+            }
+            uint8_t idx = data[2] - 1;
+            appConfig.tempInputs[idx].samplePriority = data[3];
+            appConfig.tempInputs[idx].dataRate = data[4];
+            break;
+        }
+        case 1: {
+            bool validInput = InputValid_isValidPressureInput(data[2]);
+            if (!validInput) {
+                return ECommandResult_CMD_INVALID_SENSOR_NUMBER;
+            }
+            uint8_t idx = data[2] - 1;
+            appConfig.pressureInputs[idx].samplePriority = data[3];
+            appConfig.pressureInputs[idx].dataRate = data[4];
+            break;
+        }
+        default: {
+            return ECommandResult_CMD_INVALID_SENSOR_NUMBER;
+            break;
+        }
+    }
+    Hardware_initialize(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setFilter(const uint8_t data[8]) {
+    if (data[1] >= static_cast<uint8_t>(EValueId_VALUE_ID_COUNT)) {
+        return ECommandResult_CMD_UNKNOWN_VALUE;
+    }
+    bool derived = DerivedValues_isDerived(static_cast<EValueId>(data[1]));
+    if (derived) {
+        return ECommandResult_CMD_UNKNOWN_VALUE;
+    }
+    bool validType = InputValid_isValidFilterType(data[2]);
+    if (!validType) {
+        return ECommandResult_CMD_INVALID_FILTER;
+    }
+    uint16_t timeConstantMs = (static_cast<uint16_t>(data[3]) << 8) | static_cast<uint16_t>(data[4]);
+    appConfig.valueFilters[data[1]].filterType = static_cast<EFilterType>(data[2]);
+    appConfig.valueFilters[data[1]].timeConstantMs = timeConstantMs;
+    SignalFilter_configure(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setGlitch(const uint8_t data[8]) {
+    if (data[1] >= static_cast<uint8_t>(EValueId_VALUE_ID_COUNT)) {
+        return ECommandResult_CMD_UNKNOWN_VALUE;
+    }
+    bool derived = DerivedValues_isDerived(static_cast<EValueId>(data[1]));
+    if (derived) {
+        return ECommandResult_CMD_UNKNOWN_VALUE;
+    }
+    bool validWindow = InputValid_isValidMedianWindow(data[2]);
+    if (!validWindow) {
+        return ECommandResult_CMD_INVALID_MEDIAN_WINDOW;
+    }
+    uint16_t maxRatePerSec = (static_cast<uint16_t>(data[3]) << 8) | static_cast<uint16_t>(data[4]);
+    appConfig.valueGlitch[data[1]].medianWindow = data[2];
+    appConfig.valueGlitch[data[1]].maxRatePerSec = maxRatePerSec;
+    GlitchFilter_configure(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setCurvePoint(const uint8_t data[8]) {
+    bool validCurve = InputValid_isValidCurve(data[1]);
+    bool validPoint = InputValid_isValidCurvePoint(data[2]);
+    if (!validCurve || !validPoint) {
+        return ECommandResult_CMD_INVALID_CURVE;
+    }
+    uint8_t idx = data[1] - 1;
+    if (!CommandHandler_staging[idx]) {
+        for (uint8_t p = 0; p < CURVE_POINT_MAX; p = p + 1) {
+            CommandHandler_stagedPoints[idx][p] = appConfig.curves[idx].points[p];
+        }
+        CommandHandler_staging[idx] = true;
+    }
+    uint16_t millivolts = (static_cast<uint16_t>(data[3]) << 8) | static_cast<uint16_t>(data[4]);
+    uint16_t valueBits = (static_cast<uint16_t>(data[5]) << 8) | static_cast<uint16_t>(data[6]);
+    CommandHandler_stagedPoints[idx][data[2]].millivolts = millivolts;
+    CommandHandler_stagedPoints[idx][data[2]].valueTenths = static_cast<int16_t>(valueBits);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setCurve(const uint8_t data[8]) {
+    bool validCurve = InputValid_isValidCurve(data[1]);
+    if (!validCurve) {
+        return ECommandResult_CMD_INVALID_CURVE;
+    }
+    uint8_t idx = data[1] - 1;
+    if (data[3] == 0) {
+        appConfig.curves[idx].input = 0;
+        appConfig.curves[idx].pointCount = 0;
+        CommandHandler_staging[idx] = false;
+    } else {
+        bool validInput = false;
+        if (data[2] == 0) {
+            validInput = InputValid_isValidTempInput(data[3]);
+        } else if (data[2] == 1) {
+            validInput = InputValid_isValidPressureInput(data[3]);
+        }
+        if (!validInput) {
+            return ECommandResult_CMD_INVALID_SENSOR_NUMBER;
+        }
+        for (uint8_t c = 0; c < CURVE_SLOT_COUNT; c = c + 1) {
+            if (c != idx && appConfig.curves[c].input == data[3] && appConfig.curves[c].inputType == data[2]) {
+                return ECommandResult_CMD_INVALID_CURVE;
+            }
+        }
+        TCurveConfig candidate = appConfig.curves[idx];
+        candidate.inputType = data[2];
+        candidate.input = data[3];
+        candidate.pointCount = data[4];
+        if (CommandHandler_staging[idx]) {
+            for (uint8_t p = 0; p < CURVE_POINT_MAX; p = p + 1) {
+                candidate.points[p] = CommandHandler_stagedPoints[idx][p];
+            }
+        }
+        bool validPoints = CurveTable_isValid(candidate);
+        if (!validPoints) {
+            return ECommandResult_CMD_INVALID_CURVE;
+        }
+        appConfig.curves[idx] = candidate;
+        CommandHandler_staging[idx] = false;
+    }
+    SensorProcessor_reloadCalibration(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setStats(const uint8_t data[8]) {
+    bool validSlot = InputValid_isValidStatsSlot(data[1]);
+    if (!validSlot) {
+        return ECommandResult_CMD_INVALID_STATS;
+    }
+    uint8_t idx = data[1] - 1;
+    uint16_t windowSec = (static_cast<uint16_t>(data[3]) << 8) | static_cast<uint16_t>(data[4]);
+    if (data[2] == static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED) || windowSec == 0) {
+        appConfig.stats[idx].valueId = static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED);
+        appConfig.stats[idx].windowSec = 0;
+    } else {
+        if (data[2] >= static_cast<uint8_t>(EValueId_VALUE_ID_COUNT)) {
+            return ECommandResult_CMD_UNKNOWN_VALUE;
+        }
+        bool validWindow = InputValid_isValidStatsWindow(windowSec);
+        if (!validWindow) {
+            return ECommandResult_CMD_INVALID_STATS;
+        }
+        for (uint8_t s = 0; s < STATS_SLOT_COUNT; s = s + 1) {
+            if (s != idx && appConfig.stats[s].valueId == data[2]) {
+                appConfig.stats[s].valueId = static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED);
+                appConfig.stats[s].windowSec = 0;
+            }
+        }
+        appConfig.stats[idx].valueId = data[2];
+        appConfig.stats[idx].windowSec = windowSec;
+    }
+    RollingStats_configure(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setHold(const uint8_t data[8]) {
+    if (data[1] >= static_cast<uint8_t>(EValueId_VALUE_ID_COUNT)) {
+        return ECommandResult_CMD_UNKNOWN_VALUE;
+    }
+    bool validMode = InputValid_isValidHoldMode(data[2]);
+    if (!validMode) {
+        return ECommandResult_CMD_INVALID_HOLD;
+    }
+    uint16_t spn = (static_cast<uint16_t>(data[3]) << 8) | static_cast<uint16_t>(data[4]);
+    uint8_t matched = SpnHold_select(appConfig, static_cast<EValueId>(data[1]), spn, static_cast<ESpnHold>(data[2]));
+    if (matched == 0) {
+        return ECommandResult_CMD_INVALID_HOLD;
+    }
+    SpnHold_configure(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setPulsation(const uint8_t data[8]) {
+    uint8_t input = data[1];
+    if (input != 0) {
+        bool validInput = InputValid_isValidPressureInput(input);
+        if (!validInput) {
+            return ECommandResult_CMD_INVALID_SENSOR_NUMBER;
+        }
+        if (data[2] > 1) {
+            return ECommandResult_CMD_INVALID_PULSATION;
+        }
+    }
+    uint8_t cylinders = appConfig.pulsation.cylinders;
+    if (data[3] != 0xFF) {
+        cylinders = data[3];
+    }
+    uint8_t windowMs = appConfig.pulsation.windowMs;
+    if (data[4] != 0xFF) {
+        windowMs = data[4];
+    }
+    bool validCylinders = InputValid_isValidCylinderCount(cylinders);
+    bool validWindow = InputValid_isValidPulsationWindow(windowMs);
+    if (!validCylinders || !validWindow) {
+        return ECommandResult_CMD_INVALID_PULSATION;
+    }
+    if (input != 0) {
+        uint8_t bit = static_cast<uint8_t>((1 << (input - 1)));
+        if (data[2] == 1) {
+            appConfig.pulsation.inputMask = appConfig.pulsation.inputMask | bit;
+        } else {
+            appConfig.pulsation.inputMask = appConfig.pulsation.inputMask & ~bit;
+        }
+    }
+    appConfig.pulsation.cylinders = cylinders;
+    appConfig.pulsation.windowMs = windowMs;
+    SensorProcessor_reloadCalibration(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setAlarm(const uint8_t data[8]) {
+    bool validSlot = InputValid_isValidAlarmSlot(data[1]);
+    if (!validSlot) {
+        return ECommandResult_CMD_INVALID_ALARM;
+    }
+    uint8_t idx = data[1] - 1;
+    if (data[2] == static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED)) {
+        appConfig.alarms[idx].valueId = static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED);
+        appConfig.alarms[idx].lowTenths = ALARM_NO_LOW;
+        appConfig.alarms[idx].highTenths = ALARM_NO_HIGH;
+        appConfig.alarms[idx].hysteresisTenths = 0;
+        appConfig.alarms[idx].debounceMs = 0;
+    } else {
+        if (data[2] >= static_cast<uint8_t>(EValueId_VALUE_ID_COUNT)) {
+            return ECommandResult_CMD_UNKNOWN_VALUE;
+        }
+        uint16_t lowBits = (static_cast<uint16_t>(data[3]) << 8) | static_cast<uint16_t>(data[4]);
+        uint16_t highBits = (static_cast<uint16_t>(data[5]) << 8) | static_cast<uint16_t>(data[6]);
+        int16_t lowTenths = static_cast<int16_t>(lowBits);
+        int16_t highTenths = static_cast<int16_t>(highBits);
+        bool validLimits = InputValid_isValidAlarmLimits(lowTenths, highTenths, appConfig.alarms[idx].hysteresisTenths);
+        if (!validLimits) {
+            return ECommandResult_CMD_INVALID_ALARM;
+        }
+        for (uint8_t s = 0; s < ALARM_SLOT_COUNT; s = s + 1) {
+            if (s != idx && appConfig.alarms[s].valueId == data[2]) {
+                appConfig.alarms[s].valueId = static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED);
+                appConfig.alarms[s].lowTenths = ALARM_NO_LOW;
+                appConfig.alarms[s].highTenths = ALARM_NO_HIGH;
+                appConfig.alarms[s].hysteresisTenths = 0;
+                appConfig.alarms[s].debounceMs = 0;
+            }
+        }
+        appConfig.alarms[idx].valueId = data[2];
+        appConfig.alarms[idx].lowTenths = lowTenths;
+        appConfig.alarms[idx].highTenths = highTenths;
+    }
+    AlarmMonitor_configure(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setAlarmTiming(const uint8_t data[8]) {
+    bool validSlot = InputValid_isValidAlarmSlot(data[1]);
+    if (!validSlot) {
+        return ECommandResult_CMD_INVALID_ALARM;
+    }
+    uint8_t idx = data[1] - 1;
+    uint16_t hysteresisTenths = (static_cast<uint16_t>(data[2]) << 8) | static_cast<uint16_t>(data[3]);
+    uint16_t debounceMs = (static_cast<uint16_t>(data[4]) << 8) | static_cast<uint16_t>(data[5]);
+    bool validDebounce = InputValid_isValidAlarmDebounce(debounceMs);
+    if (!validDebounce) {
+        return ECommandResult_CMD_INVALID_ALARM;
+    }
+    if (appConfig.alarms[idx].valueId != static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED)) {
+        bool validLimits = InputValid_isValidAlarmLimits(appConfig.alarms[idx].lowTenths, appConfig.alarms[idx].highTenths, hysteresisTenths);
+        if (!validLimits) {
+            return ECommandResult_CMD_INVALID_ALARM;
+        }
+    }
+    appConfig.alarms[idx].hysteresisTenths = hysteresisTenths;
+    appConfig.alarms[idx].debounceMs = debounceMs;
+    AlarmMonitor_configure(appConfig);
+    ConfigStorage_saveConfig(appConfig);
+    return ECommandResult_CMD_SUCCESS;
+}
+
+static ECommandResult CommandHandler_setCadence(const uint8_t data[8]) {
+    bool validGroup = InputValid_isValidProcessGroup(data[1]);
+    if (!validGroup) {
+        return ECommandResult_CMD_INVALID_CADENCE;
+    }
+    uint16_t periodMs = (static_cast<uint16_t>(data[2]) << 8) | static_cast<uint16_t>(data[3]);
+    bool validPeriod = InputValid_isValidProcessPeriod(periodMs);
+    if (!validPeriod) {
+        return ECommandResult_CMD_INVALID_CADENCE;
+    }
+    appConfig.processPeriodMs[data[1]] = periodMs;
+    SensorProcessor_reloadCalibration(appConfig);
     ConfigStorage_saveConfig(appConfig);
     return ECommandResult_CMD_SUCCESS;
 }
@@ -293,6 +624,7 @@ ECommandResult CommandHandler_setNtcParam(uint8_t input, uint8_t param, float va
             break;
         }
     }
+    SensorProcessor_reloadCalibration(appConfig);
     return ECommandResult_CMD_SUCCESS;
 }
 
@@ -322,6 +654,50 @@ ECommandResult CommandHandler_process(const uint8_t data[8]) {
             return CommandHandler_applyPressurePreset(data);
             break;
         }
+        case 13: {
+            return CommandHandler_setSampling(data);
+            break;
+        }
+        case 14: {
+            return CommandHandler_setFilter(data);
+            break;
+        }
+        case 15: {
+            return CommandHandler_setGlitch(data);
+            break;
+        }
+        case 16: {
+            return CommandHandler_setCurvePoint(data);
+            break;
+        }
+        case 17: {
+            return CommandHandler_setCurve(data);
+            break;
+        }
+        case 18: {
+            return CommandHandler_setStats(data);
+            break;
+        }
+        case 19: {
+            return CommandHandler_setHold(data);
+            break;
+        }
+        case 20: {
+            return CommandHandler_setPulsation(data);
+            break;
+        }
+        case 21: {
+            return CommandHandler_setAlarm(data);
+            break;
+        }
+        case 22: {
+            return CommandHandler_setAlarmTiming(data);
+            break;
+        }
+        case 23: {
+            return CommandHandler_setCadence(data);
+            break;
+        }
         default: {
             return ECommandResult_CMD_UNKNOWN_COMMAND;
             break;
@@ -0,0 +1,157 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "DerivedValues.h"
+
+// Derived Values
+// Virtual EValueIds (boost, compressor pressure ratio, CAC efficiency,
+// oil-coolant delta) computed from published sensor values per
+// DERIVED_CONFIGS. SensorProcessor marks each value it publishes; update()
+// then re-evaluates only the entries that read a changed value, once per
+// processing tick. A derived value is available (hasHardware) when all of
+// its sources are, so J1939 sends it like any sensor-backed value.
+#include <Data/SensorValues.h>
+#include <Data/DerivedConfig.h>
+#include <Display/SensorConvert.h>
+#include <Display/FixedConvert.h>
+#include <Domain/RollingStats.h>
+#include <Display/SpnHold.h>
+#include <Domain/AlarmMonitor.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Scope: DerivedValues */
+static uint32_t DerivedValues_changedMask = 0;
+static uint32_t DerivedValues_dependMask[4] = {0};
+
+static uint32_t DerivedValues_bitFor(EValueId id) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return 0;
+    }
+    return static_cast<uint32_t>(1) << static_cast<uint8_t>(id);
+}
+
+static bool DerivedValues_hasSource(EValueId id) {
+    if (id == EValueId_VALUE_UNASSIGNED || id == EValueId_AMBIENT_PRES) {
+        return true;
+    }
+    return SensorValues_current[id].hasHardware;
+}
+
+static float DerivedValues_sourceValue(EValueId id) {
+    float value = SensorValues_current[id].value;
+    if (id == EValueId_AMBIENT_PRES && value <= 0.0) {
+        return SensorConvert_defaultAtmosphericPressure();
+    }
+    return value;
+}
+
+static bool DerivedValues_sourceValid(EValueId id) {
+    if (id == EValueId_VALUE_UNASSIGNED) {
+        return true;
+    }
+    if (id == EValueId_AMBIENT_PRES && !SensorValues_current[id].hasHardware) {
+        return true;
+    }
+    return SensorValues_current[id].valid;
+}
+
+static bool DerivedValues_isFixedSource(EValueId id) {
+    return SensorValues_current[id].hasHardware && SensorValues_current[id].fixedValid;
+}
+
+static bool DerivedValues_evaluate(const TDerivedConfig& cfg) {
+    float a = DerivedValues_sourceValue(cfg.a);
+    float b = DerivedValues_sourceValue(cfg.b);
+    float result = 0.0;
+    bool validA = DerivedValues_sourceValid(cfg.a);
+    bool validB = DerivedValues_sourceValid(cfg.b);
+    bool validC = DerivedValues_sourceValid(cfg.c);
+    bool valid = validA && validB && validC;
+    if (cfg.op == EDerivedOp_DERIVED_DIFF) {
+        bool aFixed = DerivedValues_isFixedSource(cfg.a);
+        bool bFixed = DerivedValues_isFixedSource(cfg.b);
+        if (valid && aFixed && bFixed) {
+            int32_t diffQ10 = SensorValues_current[cfg.a].fixedValue - SensorValues_current[cfg.b].fixedValue;
+            SensorValues_current[cfg.dest].value = FixedConvert_toFloat(diffQ10);
+            SensorValues_current[cfg.dest].fixedValue = diffQ10;
+            SensorValues_current[cfg.dest].fixedValid = true;
+            SensorValues_current[cfg.dest].valid = true;
+            return true;
+        }
+        if (valid) {
+            result = a - b;
+        }
+    } else if (cfg.op == EDerivedOp_DERIVED_RATIO) {
+        valid = valid && b > 0.0;
+        if (valid) {
+            result = a / b;
+        }
+    } else {
+        float c = DerivedValues_sourceValue(cfg.c);
+        float span = a - c;
+        valid = valid && span >= 1.0;
+        if (valid) {
+            result = (a - b) / span * 100.0;
+        }
+        if (result < 0.0) {
+            result = 0.0;
+        }
+        if (result > 100.0) {
+            result = 100.0;
+        }
+    }
+    SensorValues_current[cfg.dest].value = result;
+    SensorValues_current[cfg.dest].fixedValid = false;
+    SensorValues_current[cfg.dest].valid = valid;
+    return valid;
+}
+
+bool DerivedValues_isDerived(EValueId id) {
+    for (uint8_t i = 0; i < DERIVED_CONFIG_COUNT; i += 1) {
+        if (DERIVED_CONFIGS[i].dest == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DerivedValues_markChanged(EValueId id) {
+    DerivedValues_changedMask = DerivedValues_changedMask | DerivedValues_bitFor(id);
+}
+
+void DerivedValues_refreshAvailability(void) {
+    for (uint8_t i = 0; i < DERIVED_CONFIG_COUNT; i += 1) {
+        TDerivedConfig cfg = DERIVED_CONFIGS[i];
+        DerivedValues_dependMask[i] = DerivedValues_bitFor(cfg.a) | DerivedValues_bitFor(cfg.b) | DerivedValues_bitFor(cfg.c);
+        bool hasA = DerivedValues_hasSource(cfg.a);
+        bool hasB = DerivedValues_hasSource(cfg.b);
+        bool hasC = DerivedValues_hasSource(cfg.c);
+        SensorValues_current[cfg.dest].hasHardware = hasA && hasB && hasC;
+        SensorValues_current[cfg.dest].value = 0.0;
+        SensorValues_current[cfg.dest].fixedValid = false;
+        SensorValues_current[cfg.dest].valid = false;
+    }
+    DerivedValues_changedMask = 0xFFFFFFFF;
+}
+
+void DerivedValues_update(uint32_t timestampUs) {
+    if (DerivedValues_changedMask == 0) {
+        return;
+    }
+    for (uint8_t i = 0; i < DERIVED_CONFIG_COUNT; i += 1) {
+        TDerivedConfig cfg = DERIVED_CONFIGS[i];
+        if ((DerivedValues_dependMask[i] & DerivedValues_changedMask) != 0 && SensorValues_current[cfg.dest].hasHardware) {
+            bool valid = DerivedValues_evaluate(cfg);
+            SpnHold_capture(cfg.dest, valid);
+            AlarmMonitor_check(cfg.dest, SensorValues_current[cfg.dest].value, valid, timestampUs);
+            if (valid) {
+                RollingStats_add(cfg.dest, SensorValues_current[cfg.dest].value, timestampUs);
+            }
+        }
+    }
+    DerivedValues_changedMask = 0;
+}
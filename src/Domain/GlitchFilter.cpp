@@ -0,0 +1,126 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "GlitchFilter.h"
+
+// Glitch Filter
+// Spike rejection between conversion and SignalFilter, per EValueId.
+// A running median over the last 3 or 5 samples drops isolated spikes
+// (a bad I2C read, ignition noise) while a real step passes after
+// (window - 1) / 2 samples. An optional rate limit then clamps any change
+// faster than the configured units per second, using the real interval
+// between readings. Samples that the stage moves by more than the rate
+// limit allows are counted as rejected.
+#include <AppConfig.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Median window and rate limit state for one value
+/* Scope: GlitchFilter */
+static TGlitchState GlitchFilter_state[EValueId_VALUE_ID_COUNT] = {0};
+static uint8_t GlitchFilter_medianWindow[EValueId_VALUE_ID_COUNT] = {0};
+static float GlitchFilter_maxRatePerUs[EValueId_VALUE_ID_COUNT] = {0};
+static uint32_t GlitchFilter_rejectCount[EValueId_VALUE_ID_COUNT] = {0};
+
+static float GlitchFilter_median(EValueId id, uint8_t count) {
+    float sorted[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+    for (uint8_t i = 0; i < count; i = i + 1) {
+        sorted[i] = GlitchFilter_state[id].window[i];
+    }
+    for (uint8_t i = 1; i < count; i = i + 1) {
+        float key = sorted[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > key) {
+            sorted[j] = sorted[j - 1];
+            j = j - 1;
+        }
+        sorted[j] = key;
+    }
+    return sorted[count / 2];
+}
+
+void GlitchFilter_configure(const AppConfig& config) {
+    for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i += 1) {
+        uint8_t window = config.valueGlitch[i].medianWindow;
+        if (window < 3) {
+            window = 0;
+        }
+        if (window > 5) {
+            window = 5;
+        }
+        GlitchFilter_medianWindow[i] = window;
+        GlitchFilter_maxRatePerUs[i] = static_cast<float>(config.valueGlitch[i].maxRatePerSec) / 1000000.0;
+        GlitchFilter_state[i].primed = false;
+    }
+}
+
+bool GlitchFilter_isActive(EValueId id) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return false;
+    }
+    return GlitchFilter_medianWindow[id] > 0 || GlitchFilter_maxRatePerUs[id] > 0.0;
+}
+
+void GlitchFilter_reset(EValueId id) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return;
+    }
+    GlitchFilter_state[id].primed = false;
+}
+
+float GlitchFilter_apply(EValueId id, float sample, uint32_t timestampUs) {
+    bool active = GlitchFilter_isActive(id);
+    if (!active) {
+        return sample;
+    }
+    if (!GlitchFilter_state[id].primed) {
+        for (uint8_t i = 0; i < 5; i = i + 1) {
+            GlitchFilter_state[id].window[i] = sample;
+        }
+        GlitchFilter_state[id].head = 0;
+        GlitchFilter_state[id].lastOutput = sample;
+        GlitchFilter_state[id].lastTimestampUs = timestampUs;
+        GlitchFilter_state[id].primed = true;
+        return sample;
+    }
+    float output = sample;
+    uint8_t window = GlitchFilter_medianWindow[id];
+    if (window > 0) {
+        uint8_t head = GlitchFilter_state[id].head + 1;
+        if (head >= window) {
+            head = 0;
+        }
+        GlitchFilter_state[id].window[head] = sample;
+        GlitchFilter_state[id].head = head;
+        output = GlitchFilter_median(id, window);
+    }
+    float rate = GlitchFilter_maxRatePerUs[id];
+    if (rate > 0.0) {
+        uint32_t dt = timestampUs - GlitchFilter_state[id].lastTimestampUs;
+        float maxStep = rate * static_cast<float>(dt);
+        float last = GlitchFilter_state[id].lastOutput;
+        if (output > last + maxStep) {
+            output = last + maxStep;
+        }
+        if (output < last - maxStep) {
+            output = last - maxStep;
+        }
+        float removed = sample - output;
+        if (removed > maxStep || removed < -maxStep) {
+            GlitchFilter_rejectCount[id] = GlitchFilter_rejectCount[id] + 1;
+        }
+    }
+    GlitchFilter_state[id].lastOutput = output;
+    GlitchFilter_state[id].lastTimestampUs = timestampUs;
+    return output;
+}
+
+uint32_t GlitchFilter_getRejectCount(EValueId id) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return 0;
+    }
+    return GlitchFilter_rejectCount[id];
+}
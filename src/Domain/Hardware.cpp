@@ -9,10 +9,14 @@
 // Single entry point for all sensor hardware setup.
 // Called from setup() and after any config change.
 #include <AppConfig.h>
+#include <Data/I2cBus.h>
 #include <Data/ADS1115Manager.h>
 #include <Data/MAX31856Manager.h>
 #include <Data/BME280Manager.h>
 #include <Data/SensorValues.h>
+#include "SensorProcessor.h"
+#include "DerivedValues.h"
+#include "AlarmMonitor.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -48,12 +52,18 @@ static void Hardware_populateHardwareFlags(const AppConfig& config) {
         EValueId id = static_cast<EValueId>(i);
         bool hasHardwareAssigned = Hardware_isValueAssigned(config, id);
         SensorValues_current[id].hasHardware = hasHardwareAssigned;
+        SensorValues_current[id].fixedValid = false;
     }
+    DerivedValues_refreshAvailability();
 }
 
 void Hardware_initialize(const AppConfig& config) {
     Hardware_populateHardwareFlags(config);
+    I2cBus_initialize();
     ADS1115Manager_initialize(config);
     MAX31856Manager_initialize(config);
     BME280Manager_initialize(config);
+    SensorProcessor_reloadCalibration(config);
+    AlarmMonitor_configure(config);
+    I2cBus_setClock(SENSOR_I2C_CLOCK_HZ);
 }
@@ -14,6 +14,7 @@
 #include <Display/J1939Bus.h>
 #include <Domain/CommandHandler.h>
 #include <Display/FloatBytes.h>
+#include <Domain/RollingStats.h>
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -45,6 +46,7 @@ static void J1939CommandHandler_sendScheduledPgns(void) {
         J1939Bus_sendPgnGeneric(65270);
         J1939Bus_sendPgnGeneric(65263);
         J1939Bus_sendPgnGeneric(65190);
+        J1939Bus_sendPgnGeneric(65282);
         J1939CommandHandler_halfSecondMillis = 0;
     }
     if (J1939CommandHandler_oneSecondMillis >= 1000) {
@@ -77,6 +79,47 @@ static void J1939CommandHandler_sendConfigResponse(uint8_t cmd, uint8_t resultCo
     J1939Bus_sendMessage(65281, buf);
 }
 
+static void J1939CommandHandler_putTenths(uint8_t buf[8], uint8_t offset, float value) {
+    float scaled = value * 10.0f;
+    if (scaled > 32767.0f) {
+        scaled = 32767.0f;
+    }
+    if (scaled < -32767.0f) {
+        scaled = -32767.0f;
+    }
+    int16_t tenths = static_cast<int16_t>(scaled);
+    uint16_t raw = static_cast<uint16_t>(tenths);
+    buf[offset] = static_cast<uint8_t>(raw & 0xFF);
+    buf[offset + 1] = static_cast<uint8_t>(raw >> 8);
+}
+
+static void J1939CommandHandler_handleStatsQuery(uint8_t queryType, uint8_t slot) {
+    uint8_t respData[8] = {0};
+    J1939CommandHandler_fillBuffer(respData);
+    if (slot < 1 || slot > STATS_SLOT_COUNT) {
+        J1939CommandHandler_sendConfigResponse(5, static_cast<uint8_t>(ECommandResult_CMD_INVALID_STATS), respData, 0);
+        return;
+    }
+    TRollingStats stats = {0};
+    bool hasSamples = RollingStats_get(slot - 1, micros(), stats);
+    if (queryType == 6) {
+        if (hasSamples) {
+            J1939CommandHandler_putTenths(respData, 0, stats.minimum);
+            J1939CommandHandler_putTenths(respData, 2, stats.maximum);
+            J1939CommandHandler_putTenths(respData, 4, stats.mean);
+        }
+    } else {
+        if (hasSamples) {
+            J1939CommandHandler_putTenths(respData, 0, stats.stddev);
+        }
+        respData[2] = static_cast<uint8_t>(stats.count & 0xFF);
+        respData[3] = static_cast<uint8_t>(stats.count >> 8);
+        respData[4] = static_cast<uint8_t>(appConfig.stats[slot - 1].windowSec & 0xFF);
+        respData[5] = static_cast<uint8_t>(appConfig.stats[slot - 1].windowSec >> 8);
+    }
+    J1939CommandHandler_sendConfigResponse(5, static_cast<uint8_t>(ECommandResult_CMD_SUCCESS), respData, 6);
+}
+
 static void J1939CommandHandler_handleQuery(const uint8_t data[8]) {
     uint8_t queryType = data[1];
     uint8_t subQuery = data[2];
@@ -143,6 +186,14 @@ static void J1939CommandHandler_handleQuery(const uint8_t data[8]) {
             J1939CommandHandler_sendConfigResponse(5, static_cast<uint8_t>(ECommandResult_CMD_SUCCESS), respData, 2);
             break;
         }
+        case 6: {
+            J1939CommandHandler_handleStatsQuery(queryType, subQuery);
+            break;
+        }
+        case 7: {
+            J1939CommandHandler_handleStatsQuery(queryType, subQuery);
+            break;
+        }
         default: {
             J1939CommandHandler_sendConfigResponse(5, static_cast<uint8_t>(ECommandResult_CMD_UNKNOWN_COMMAND), respData, 0);
             break;
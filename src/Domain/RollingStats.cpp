@@ -0,0 +1,152 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "RollingStats.h"
+
+// Rolling Statistics
+// Windowed min/max/mean/stddev for up to STATS_SLOT_COUNT values, fed by
+// SensorProcessor as each value is published. Each window keeps a ring of
+// its last 256 samples. Min and max come from monotonic queues of ring
+// positions, mean and variance from Welford's update with removal, so
+// adding or expiring a sample is amortized O(1) and history is never
+// rescanned. A window longer than 256 samples keeps one sample per
+// window / 256, so the ring always spans the whole window.
+#include <math.h>
+#include <AppConfig.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Ring of samples and running aggregates for one window
+// Statistics for one window at the time of the query
+/* Scope: RollingStats */
+static TStatsWindow RollingStats_windows[4] = {0};
+static uint8_t RollingStats_slotOf[EValueId_VALUE_ID_COUNT] = {0};
+
+static void RollingStats_clear(uint8_t s) {
+    RollingStats_windows[s].head = 0;
+    RollingStats_windows[s].count = 0;
+    RollingStats_windows[s].minFront = 0;
+    RollingStats_windows[s].minCount = 0;
+    RollingStats_windows[s].maxFront = 0;
+    RollingStats_windows[s].maxCount = 0;
+    RollingStats_windows[s].mean = 0.0;
+    RollingStats_windows[s].m2 = 0.0;
+}
+
+static void RollingStats_evictOldest(uint8_t s) {
+    uint8_t pos = static_cast<uint8_t>(RollingStats_windows[s].head);
+    float x = RollingStats_windows[s].samples[pos];
+    if (RollingStats_windows[s].minCount > 0 && RollingStats_windows[s].minQueue[RollingStats_windows[s].minFront] == pos) {
+        RollingStats_windows[s].minFront = (RollingStats_windows[s].minFront + 1) & 0xFF;
+        RollingStats_windows[s].minCount = RollingStats_windows[s].minCount - 1;
+    }
+    if (RollingStats_windows[s].maxCount > 0 && RollingStats_windows[s].maxQueue[RollingStats_windows[s].maxFront] == pos) {
+        RollingStats_windows[s].maxFront = (RollingStats_windows[s].maxFront + 1) & 0xFF;
+        RollingStats_windows[s].maxCount = RollingStats_windows[s].maxCount - 1;
+    }
+    uint16_t n = RollingStats_windows[s].count - 1;
+    if (n == 0) {
+        RollingStats_windows[s].mean = 0.0;
+        RollingStats_windows[s].m2 = 0.0;
+    } else {
+        float delta = x - RollingStats_windows[s].mean;
+        RollingStats_windows[s].mean = RollingStats_windows[s].mean - delta / static_cast<float>(n);
+        float m2 = RollingStats_windows[s].m2 - delta * (x - RollingStats_windows[s].mean);
+        if (m2 < 0.0) {
+            m2 = 0.0;
+        }
+        RollingStats_windows[s].m2 = m2;
+    }
+    RollingStats_windows[s].count = n;
+    RollingStats_windows[s].head = (RollingStats_windows[s].head + 1) & 0xFF;
+}
+
+static void RollingStats_expire(uint8_t s, uint32_t nowUs) {
+    while (RollingStats_windows[s].count > 0) {
+        int32_t age = static_cast<int32_t>((nowUs - RollingStats_windows[s].timestamps[RollingStats_windows[s].head]));
+        if (age <= RollingStats_windows[s].windowUs) {
+            return;
+        }
+        RollingStats_evictOldest(s);
+    }
+}
+
+void RollingStats_configure(const AppConfig& config) {
+    for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i += 1) {
+        RollingStats_slotOf[i] = STATS_SLOT_COUNT;
+    }
+    for (uint8_t s = 0; s < STATS_SLOT_COUNT; s += 1) {
+        RollingStats_clear(s);
+        uint8_t id = config.stats[s].valueId;
+        uint16_t windowSec = config.stats[s].windowSec;
+        if (windowSec > 1800) {
+            windowSec = 1800;
+        }
+        if (id < EValueId_VALUE_ID_COUNT && windowSec > 0 && RollingStats_slotOf[id] == STATS_SLOT_COUNT) {
+            RollingStats_slotOf[id] = s;
+            RollingStats_windows[s].windowUs = static_cast<int32_t>(windowSec) * 1000000;
+            RollingStats_windows[s].spacingUs = static_cast<uint32_t>(RollingStats_windows[s].windowUs) / 256;
+        }
+    }
+}
+
+void RollingStats_add(EValueId id, float value, uint32_t timestampUs) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return;
+    }
+    uint8_t s = RollingStats_slotOf[id];
+    if (s >= STATS_SLOT_COUNT) {
+        return;
+    }
+    if (RollingStats_windows[s].count > 0 && timestampUs - RollingStats_windows[s].lastAcceptedUs < RollingStats_windows[s].spacingUs) {
+        return;
+    }
+    RollingStats_expire(s, timestampUs);
+    if (RollingStats_windows[s].count >= 256) {
+        RollingStats_evictOldest(s);
+    }
+    uint8_t pos = static_cast<uint8_t>(((RollingStats_windows[s].head + RollingStats_windows[s].count) & 0xFF));
+    RollingStats_windows[s].samples[pos] = value;
+    RollingStats_windows[s].timestamps[pos] = timestampUs;
+    while (RollingStats_windows[s].minCount > 0 && RollingStats_windows[s].samples[RollingStats_windows[s].minQueue[(RollingStats_windows[s].minFront + RollingStats_windows[s].minCount - 1) & 0xFF]] >= value) {
+        RollingStats_windows[s].minCount = RollingStats_windows[s].minCount - 1;
+    }
+    RollingStats_windows[s].minQueue[(RollingStats_windows[s].minFront + RollingStats_windows[s].minCount) & 0xFF] = pos;
+    RollingStats_windows[s].minCount = RollingStats_windows[s].minCount + 1;
+    while (RollingStats_windows[s].maxCount > 0 && RollingStats_windows[s].samples[RollingStats_windows[s].maxQueue[(RollingStats_windows[s].maxFront + RollingStats_windows[s].maxCount - 1) & 0xFF]] <= value) {
+        RollingStats_windows[s].maxCount = RollingStats_windows[s].maxCount - 1;
+    }
+    RollingStats_windows[s].maxQueue[(RollingStats_windows[s].maxFront + RollingStats_windows[s].maxCount) & 0xFF] = pos;
+    RollingStats_windows[s].maxCount = RollingStats_windows[s].maxCount + 1;
+    uint16_t n = RollingStats_windows[s].count + 1;
+    float delta = value - RollingStats_windows[s].mean;
+    RollingStats_windows[s].mean = RollingStats_windows[s].mean + delta / static_cast<float>(n);
+    RollingStats_windows[s].m2 = RollingStats_windows[s].m2 + delta * (value - RollingStats_windows[s].mean);
+    RollingStats_windows[s].count = n;
+    RollingStats_windows[s].lastAcceptedUs = timestampUs;
+}
+
+bool RollingStats_get(uint8_t slot, uint32_t nowUs, TRollingStats& result) {
+    result.minimum = 0.0;
+    result.maximum = 0.0;
+    result.mean = 0.0;
+    result.stddev = 0.0;
+    result.count = 0;
+    if (slot >= STATS_SLOT_COUNT) {
+        return false;
+    }
+    RollingStats_expire(slot, nowUs);
+    uint16_t n = RollingStats_windows[slot].count;
+    if (n == 0) {
+        return false;
+    }
+    result.minimum = RollingStats_windows[slot].samples[RollingStats_windows[slot].minQueue[RollingStats_windows[slot].minFront]];
+    result.maximum = RollingStats_windows[slot].samples[RollingStats_windows[slot].maxQueue[RollingStats_windows[slot].maxFront]];
+    result.mean = RollingStats_windows[slot].mean;
+    result.stddev = sqrt(RollingStats_windows[slot].m2 / static_cast<float>(n));
+    result.count = n;
+    return true;
+}
@@ -9,12 +9,23 @@
 // Reads from hardware managers and stores values in SensorValues
 #include <Arduino.h>
 #include <AppConfig.h>
+#include <Data/I2cBus.h>
 #include <Data/ADS1115Manager.h>
 #include <Data/MAX31856Manager.h>
 #include <Data/BME280Manager.h>
 #include <Display/SensorConvert.h>
+#include <Display/FixedConvert.h>
+#include <Display/NtcTable.h>
+#include <Display/CurveTable.h>
 #include <Display/HardwareMap.h>
 #include <Data/SensorValues.h>
+#include <Domain/GlitchFilter.h>
+#include <Domain/SignalFilter.h>
+#include <Domain/DerivedValues.h>
+#include <Domain/RollingStats.h>
+#include <Display/SpnHold.h>
+#include <Display/J1939Bus.h>
+#include <Domain/AlarmMonitor.h>
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -22,11 +33,55 @@
 /* Scope: SensorProcessor */
 static IntervalTimer SensorProcessor_sensorTimer = {};
 static bool SensorProcessor_sensorUpdateReady = false;
+static uint32_t SensorProcessor_groupPeriodUs[4] = {0};
+static uint32_t SensorProcessor_groupDueUs[4] = {0};
+static uint8_t SensorProcessor_tempPlanCount = 0;
+static uint8_t SensorProcessor_tempPlanDevice[8] = {0};
+static uint8_t SensorProcessor_tempPlanChannel[8] = {0};
+static uint32_t SensorProcessor_tempPlanSeq[8] = {0};
+static uint8_t SensorProcessor_tempFreshSlots[8] = {0};
+static EValueId SensorProcessor_tempPlanDest[8] = {};
+static TNtcTable SensorProcessor_tempPlanTables[8] = {0};
+static int32_t SensorProcessor_tempPlanCounts[8] = {0};
+static int32_t SensorProcessor_tempPlanResults[8] = {0};
+static uint8_t SensorProcessor_pressurePlanCount = 0;
+static uint8_t SensorProcessor_pressurePlanDevice[7] = {0};
+static uint8_t SensorProcessor_pressurePlanChannel[7] = {0};
+static uint32_t SensorProcessor_pressurePlanSeq[7] = {0};
+static uint8_t SensorProcessor_pressureFreshSlots[7] = {0};
+static EValueId SensorProcessor_pressurePlanDest[7] = {};
+static TPressureFixed SensorProcessor_pressurePlanCoeffs[7] = {0};
+static uint32_t SensorProcessor_pressurePlanMultiplier[7] = {0};
+static int32_t SensorProcessor_pressurePlanIntercept[7] = {0};
+static int32_t SensorProcessor_pressurePlanFullScale[7] = {0};
+static int32_t SensorProcessor_pressurePlanCounts[7] = {0};
+static int32_t SensorProcessor_pressurePlanResults[7] = {0};
+static bool SensorProcessor_pressurePlanPulsation[7] = {0};
+static uint32_t SensorProcessor_pressurePlanSpanUs[7] = {0};
+static bool SensorProcessor_pulsationActive = false;
+static uint8_t SensorProcessor_pulsationCylinders = 0;
+static uint32_t SensorProcessor_pulsationMinWindowUs = 0;
+static uint8_t SensorProcessor_curvePlanCount = 0;
+static uint8_t SensorProcessor_curvePlanDevice[2] = {0};
+static uint8_t SensorProcessor_curvePlanChannel[2] = {0};
+static uint32_t SensorProcessor_curvePlanSeq[2] = {0};
+static EValueId SensorProcessor_curvePlanDest[2] = {};
+static TCurveTable SensorProcessor_curvePlanTables[2] = {0};
+static EProcessGroup SensorProcessor_curvePlanGroup[2] = {};
+static int32_t SensorProcessor_atmosphericQ10 = 0;
+static bool SensorProcessor_atmosphericStale = true;
+static bool SensorProcessor_slowInputsStale = true;
+static bool SensorProcessor_egtPending = false;
+static bool SensorProcessor_bmePending = false;
 
 static void SensorProcessor_sensorTimerISR(void) {
     SensorProcessor_sensorUpdateReady = true;
 }
 
+static bool SensorProcessor_isDue(uint8_t dueMask, EProcessGroup group) {
+    return ((dueMask >> static_cast<uint8_t>(group)) & 1) != 0;
+}
+
 static float SensorProcessor_getAtmosphericPressurekPa(void) {
     float baro = SensorValues_current[EValueId_AMBIENT_PRES].value;
     if (baro > 0.0) {
@@ -35,32 +90,159 @@ static float SensorProcessor_getAtmosphericPressurekPa(void) {
     return SensorConvert_defaultAtmosphericPressure();
 }
 
+static void SensorProcessor_publishFixed(EValueId val, int32_t valueQ10, bool valid, uint32_t timestampUs) {
+    bool deglitched = GlitchFilter_isActive(val);
+    bool filtered = SignalFilter_isActive(val);
+    if (!valid) {
+        GlitchFilter_reset(val);
+        SignalFilter_reset(val);
+        deglitched = false;
+        filtered = false;
+    }
+    if (deglitched || filtered) {
+        float clean = GlitchFilter_apply(val, FixedConvert_toFloat(valueQ10), timestampUs);
+        float smoothed = SignalFilter_apply(val, clean, timestampUs);
+        SensorValues_current[val].value = smoothed;
+        SensorValues_current[val].fixedValue = FixedConvert_fromFloat(smoothed);
+    } else {
+        SensorValues_current[val].value = FixedConvert_toFloat(valueQ10);
+        SensorValues_current[val].fixedValue = valueQ10;
+    }
+    SensorValues_current[val].fixedValid = valid;
+    SensorValues_current[val].valid = valid;
+    DerivedValues_markChanged(val);
+    SpnHold_capture(val, valid);
+    AlarmMonitor_check(val, SensorValues_current[val].value, valid, timestampUs);
+    if (valid) {
+        RollingStats_add(val, SensorValues_current[val].value, timestampUs);
+    }
+}
+
+static void SensorProcessor_publishFloat(EValueId val, float value, bool valid, uint32_t timestampUs) {
+    if (!valid) {
+        GlitchFilter_reset(val);
+        SignalFilter_reset(val);
+        SensorValues_current[val].value = value;
+        SensorValues_current[val].valid = false;
+        DerivedValues_markChanged(val);
+        SpnHold_capture(val, false);
+        AlarmMonitor_check(val, value, false, timestampUs);
+        return;
+    }
+    float clean = GlitchFilter_apply(val, value, timestampUs);
+    SensorValues_current[val].value = SignalFilter_apply(val, clean, timestampUs);
+    SensorValues_current[val].valid = true;
+    DerivedValues_markChanged(val);
+    SpnHold_capture(val, true);
+    AlarmMonitor_check(val, SensorValues_current[val].value, true, timestampUs);
+    RollingStats_add(val, SensorValues_current[val].value, timestampUs);
+}
+
 static void SensorProcessor_processTempInputs(void) {
-    for (uint8_t i = 0; i < TEMP_INPUT_COUNT; i += 1) {
-        EValueId val = appConfig.tempInputs[i].assignedValue;
-        if (val == EValueId_VALUE_UNASSIGNED) {
-            continue;
+    uint8_t fresh = 0;
+    for (uint8_t k = 0; k < SensorProcessor_tempPlanCount; k = k + 1) {
+        uint32_t seq = ADS1115Manager_getDecimatedSeq(SensorProcessor_tempPlanDevice[k], SensorProcessor_tempPlanChannel[k]);
+        if (seq != SensorProcessor_tempPlanSeq[k]) {
+            SensorProcessor_tempPlanSeq[k] = seq;
+            SensorProcessor_tempPlanCounts[k] = ADS1115Manager_getDecimatedCounts(SensorProcessor_tempPlanDevice[k], SensorProcessor_tempPlanChannel[k]);
+            SensorProcessor_tempFreshSlots[fresh] = k;
+            fresh = fresh + 1;
         }
-        uint8_t device = HardwareMap_tempDevice(i);
-        uint8_t channel = HardwareMap_tempChannel(i);
-        float voltage = ADS1115Manager_getVoltage(device, channel);
-        float tempC = SensorConvert_ntcTemperature(voltage, appConfig.tempInputs[i]);
-        SensorValues_current[val].value = tempC;
+    }
+    NtcTable_lookupBatch(fresh, SensorProcessor_tempFreshSlots, SensorProcessor_tempPlanCounts, SensorProcessor_tempPlanTables, SensorProcessor_tempPlanResults);
+    for (uint8_t j = 0; j < fresh; j = j + 1) {
+        uint8_t k = SensorProcessor_tempFreshSlots[j];
+        int32_t tempQ10 = SensorProcessor_tempPlanResults[k];
+        uint32_t timestamp = ADS1115Manager_getDecimatedTimestamp(SensorProcessor_tempPlanDevice[k], SensorProcessor_tempPlanChannel[k]);
+        bool valid = ADS1115Manager_isDecimatedValid(SensorProcessor_tempPlanDevice[k], SensorProcessor_tempPlanChannel[k]);
+        SensorProcessor_publishFixed(SensorProcessor_tempPlanDest[k], tempQ10, valid && tempQ10 != NtcTable_ERROR_Q10, timestamp);
     }
 }
 
+static bool SensorProcessor_refreshAtmospheric(void) {
+    float atm = SensorProcessor_getAtmosphericPressurekPa();
+    int32_t atmQ10 = FixedConvert_fromFloat(atm);
+    if (!SensorProcessor_atmosphericStale && atmQ10 == SensorProcessor_atmosphericQ10) {
+        return false;
+    }
+    for (uint8_t k = 0; k < SensorProcessor_pressurePlanCount; k = k + 1) {
+        FixedConvert_applyAtmospheric(SensorProcessor_pressurePlanCoeffs[k], atmQ10);
+        SensorProcessor_pressurePlanMultiplier[k] = SensorProcessor_pressurePlanCoeffs[k].multiplier;
+        SensorProcessor_pressurePlanIntercept[k] = SensorProcessor_pressurePlanCoeffs[k].interceptQ10;
+        SensorProcessor_pressurePlanFullScale[k] = SensorProcessor_pressurePlanCoeffs[k].fullScaleQ10;
+    }
+    SensorProcessor_atmosphericQ10 = atmQ10;
+    SensorProcessor_atmosphericStale = false;
+    return true;
+}
+
+static uint32_t SensorProcessor_pulsationPeriodUs(void) {
+    float rpm = J1939Bus_getEngineRpm();
+    if (rpm < 100.0 || SensorProcessor_pulsationCylinders == 0) {
+        return 0;
+    }
+    return static_cast<uint32_t>((120000000.0 / (rpm * static_cast<float>(SensorProcessor_pulsationCylinders))));
+}
+
+static uint32_t SensorProcessor_pulsationWindowUs(uint32_t periodUs, uint32_t historyUs) {
+    if (periodUs == 0) {
+        return SensorProcessor_pulsationMinWindowUs;
+    }
+    uint32_t periods = (SensorProcessor_pulsationMinWindowUs + periodUs - 1) / periodUs;
+    if (periods < 1) {
+        periods = 1;
+    }
+    if (periods * periodUs > historyUs && historyUs >= periodUs) {
+        periods = historyUs / periodUs;
+    }
+    return periods * periodUs;
+}
+
 static void SensorProcessor_processPressureInputs(void) {
-    for (uint8_t i = 0; i < PRESSURE_INPUT_COUNT; i += 1) {
-        EValueId val = appConfig.pressureInputs[i].assignedValue;
-        if (val == EValueId_VALUE_UNASSIGNED) {
-            continue;
+    bool baroChanged = SensorProcessor_refreshAtmospheric();
+    uint32_t periodUs = 0;
+    if (SensorProcessor_pulsationActive) {
+        periodUs = SensorProcessor_pulsationPeriodUs();
+    }
+    uint8_t fresh = 0;
+    for (uint8_t k = 0; k < SensorProcessor_pressurePlanCount; k = k + 1) {
+        uint32_t seq = ADS1115Manager_getDecimatedSeq(SensorProcessor_pressurePlanDevice[k], SensorProcessor_pressurePlanChannel[k]);
+        if (baroChanged || seq != SensorProcessor_pressurePlanSeq[k]) {
+            SensorProcessor_pressurePlanSeq[k] = seq;
+            if (SensorProcessor_pressurePlanPulsation[k]) {
+                uint32_t historyUs = ADS1115Manager_getHistorySpanUs(SensorProcessor_pressurePlanDevice[k], SensorProcessor_pressurePlanChannel[k]);
+                uint32_t windowUs = SensorProcessor_pulsationWindowUs(periodUs, historyUs);
+                TWindowAverage average = ADS1115Manager_getWindowCounts(SensorProcessor_pressurePlanDevice[k], SensorProcessor_pressurePlanChannel[k], windowUs);
+                SensorProcessor_pressurePlanCounts[k] = average.counts;
+                SensorProcessor_pressurePlanSpanUs[k] = average.spanUs;
+            } else {
+                SensorProcessor_pressurePlanCounts[k] = ADS1115Manager_getDecimatedCounts(SensorProcessor_pressurePlanDevice[k], SensorProcessor_pressurePlanChannel[k]);
+            }
+            SensorProcessor_pressureFreshSlots[fresh] = k;
+            fresh = fresh + 1;
+        }
+    }
+    FixedConvert_pressureBatch(fresh, SensorProcessor_pressureFreshSlots, SensorProcessor_pressurePlanCounts, SensorProcessor_pressurePlanMultiplier, SensorProcessor_pressurePlanIntercept, SensorProcessor_pressurePlanFullScale, SensorProcessor_pressurePlanResults);
+    for (uint8_t j = 0; j < fresh; j = j + 1) {
+        uint8_t k = SensorProcessor_pressureFreshSlots[j];
+        uint32_t timestamp = ADS1115Manager_getDecimatedTimestamp(SensorProcessor_pressurePlanDevice[k], SensorProcessor_pressurePlanChannel[k]);
+        bool valid = ADS1115Manager_isDecimatedValid(SensorProcessor_pressurePlanDevice[k], SensorProcessor_pressurePlanChannel[k]);
+        SensorProcessor_publishFixed(SensorProcessor_pressurePlanDest[k], SensorProcessor_pressurePlanResults[k], valid, timestamp);
+    }
+}
+
+static void SensorProcessor_processCurveInputs(uint8_t dueMask) {
+    for (uint8_t k = 0; k < SensorProcessor_curvePlanCount; k = k + 1) {
+        uint32_t seq = ADS1115Manager_getDecimatedSeq(SensorProcessor_curvePlanDevice[k], SensorProcessor_curvePlanChannel[k]);
+        bool due = SensorProcessor_isDue(dueMask, SensorProcessor_curvePlanGroup[k]);
+        if (due && seq != SensorProcessor_curvePlanSeq[k]) {
+            SensorProcessor_curvePlanSeq[k] = seq;
+            int32_t counts = ADS1115Manager_getDecimatedCounts(SensorProcessor_curvePlanDevice[k], SensorProcessor_curvePlanChannel[k]);
+            int32_t valueQ10 = CurveTable_lookup(counts, SensorProcessor_curvePlanTables[k]);
+            uint32_t timestamp = ADS1115Manager_getDecimatedTimestamp(SensorProcessor_curvePlanDevice[k], SensorProcessor_curvePlanChannel[k]);
+            bool valid = ADS1115Manager_isDecimatedValid(SensorProcessor_curvePlanDevice[k], SensorProcessor_curvePlanChannel[k]);
+            SensorProcessor_publishFixed(SensorProcessor_curvePlanDest[k], valueQ10, valid, timestamp);
         }
-        uint8_t device = HardwareMap_pressureDevice(i);
-        uint8_t channel = HardwareMap_pressureChannel(i);
-        float voltage = ADS1115Manager_getVoltage(device, channel);
-        float atm = SensorProcessor_getAtmosphericPressurekPa();
-        float pressurekPa = SensorConvert_pressure(voltage, appConfig.pressureInputs[i], atm);
-        SensorValues_current[val].value = pressurekPa;
     }
 }
 
@@ -68,7 +250,8 @@ static void SensorProcessor_processEgt(void) {
     bool egtReady = MAX31856Manager_isEnabled();
     if (appConfig.egtEnabled && egtReady) {
         float temp = MAX31856Manager_getTemperatureC();
-        SensorValues_current[EValueId_TURBO1_TURB_INLET_TEMP].value = temp;
+        uint32_t timestamp = MAX31856Manager_getReadingTimestamp();
+        SensorProcessor_publishFloat(EValueId_TURBO1_TURB_INLET_TEMP, temp, temp > -273.0, timestamp);
     }
 }
 
@@ -78,33 +261,174 @@ static void SensorProcessor_processBme280(void) {
         float temp = BME280Manager_getTemperatureC();
         float humidity = BME280Manager_getHumidity();
         float pressure = BME280Manager_getPressurekPa();
-        SensorValues_current[EValueId_AMBIENT_TEMP].value = temp;
-        SensorValues_current[EValueId_AMBIENT_HUMIDITY].value = humidity;
-        SensorValues_current[EValueId_AMBIENT_PRES].value = pressure;
+        bool valid = temp > -273.0;
+        uint32_t timestamp = micros();
+        SensorProcessor_publishFloat(EValueId_AMBIENT_TEMP, temp, valid, timestamp);
+        SensorProcessor_publishFloat(EValueId_AMBIENT_HUMIDITY, humidity, valid, timestamp);
+        SensorProcessor_publishFloat(EValueId_AMBIENT_PRES, pressure, valid, timestamp);
+    }
+}
+
+static void SensorProcessor_processAllInputs(uint8_t dueMask) {
+    if ((SensorProcessor_bmePending && SensorProcessor_isDue(dueMask, EProcessGroup_PROCESS_BME280)) || SensorProcessor_slowInputsStale) {
+        SensorProcessor_bmePending = false;
+        SensorProcessor_processBme280();
+    }
+    if (SensorProcessor_isDue(dueMask, EProcessGroup_PROCESS_TEMPERATURE)) {
+        SensorProcessor_processTempInputs();
     }
+    if (SensorProcessor_isDue(dueMask, EProcessGroup_PROCESS_PRESSURE)) {
+        SensorProcessor_processPressureInputs();
+    }
+    SensorProcessor_processCurveInputs(dueMask);
+    if ((SensorProcessor_egtPending && SensorProcessor_isDue(dueMask, EProcessGroup_PROCESS_EGT)) || SensorProcessor_slowInputsStale) {
+        SensorProcessor_egtPending = false;
+        SensorProcessor_processEgt();
+    }
+    SensorProcessor_slowInputsStale = false;
+    DerivedValues_update(micros());
+    AlarmMonitor_flush();
 }
 
-static void SensorProcessor_processAllInputs(void) {
-    SensorProcessor_processTempInputs();
-    SensorProcessor_processPressureInputs();
-    SensorProcessor_processEgt();
-    SensorProcessor_processBme280();
+static uint8_t SensorProcessor_takeDueGroups(uint32_t nowUs) {
+    uint8_t dueMask = 0;
+    for (uint8_t g = 0; g < PROCESS_GROUP_COUNT; g += 1) {
+        if (static_cast<int32_t>((nowUs - SensorProcessor_groupDueUs[g])) >= 0) {
+            dueMask = dueMask | static_cast<uint8_t>((1 << g));
+            SensorProcessor_groupDueUs[g] = SensorProcessor_groupDueUs[g] + SensorProcessor_groupPeriodUs[g];
+            if (static_cast<int32_t>((nowUs - SensorProcessor_groupDueUs[g])) >= 0) {
+                SensorProcessor_groupDueUs[g] = nowUs + SensorProcessor_groupPeriodUs[g];
+            }
+        }
+    }
+    return dueMask;
 }
 
-static void SensorProcessor_pollAndProcess(void) {
-    ADS1115Manager_update();
-    MAX31856Manager_update();
-    BME280Manager_update();
-    SensorProcessor_processAllInputs();
+static void SensorProcessor_armTimer(void) {
+    uint32_t nowUs = micros();
+    int32_t waitUs = static_cast<int32_t>((SensorProcessor_groupDueUs[0] - nowUs));
+    for (uint8_t g = 1; g < PROCESS_GROUP_COUNT; g += 1) {
+        int32_t leftUs = static_cast<int32_t>((SensorProcessor_groupDueUs[g] - nowUs));
+        if (leftUs < waitUs) {
+            waitUs = leftUs;
+        }
+    }
+    if (waitUs < static_cast<int32_t>(100)) {
+        waitUs = static_cast<int32_t>(100);
+    }
+    SensorProcessor_sensorTimer.begin(SensorProcessor_sensorTimerISR, static_cast<uint32_t>(waitUs));
+}
+
+static uint8_t SensorProcessor_curveSlotFor(const AppConfig& config, uint8_t inputType, uint8_t input) {
+    for (uint8_t c = 0; c < CURVE_SLOT_COUNT; c = c + 1) {
+        bool valid = CurveTable_isValid(config.curves[c]);
+        if (valid && config.curves[c].inputType == inputType && config.curves[c].input == input) {
+            return c;
+        }
+    }
+    return CURVE_SLOT_COUNT;
+}
+
+static void SensorProcessor_addCurveInput(const TCurveConfig& curve, EValueId val, uint8_t device, uint8_t channel, EProcessGroup group) {
+    uint8_t k = SensorProcessor_curvePlanCount;
+    SensorProcessor_curvePlanDevice[k] = device;
+    SensorProcessor_curvePlanChannel[k] = channel;
+    SensorProcessor_curvePlanDest[k] = val;
+    SensorProcessor_curvePlanGroup[k] = group;
+    SensorProcessor_curvePlanSeq[k] = ADS1115Manager_getDecimatedSeq(device, channel) - 1;
+    CurveTable_build(SensorProcessor_curvePlanTables[k], curve);
+    SensorProcessor_curvePlanCount = k + 1;
+}
+
+void SensorProcessor_reloadCalibration(const AppConfig& config) {
+    SensorProcessor_curvePlanCount = 0;
+    SensorProcessor_tempPlanCount = 0;
+    for (uint8_t i = 0; i < TEMP_INPUT_COUNT; i += 1) {
+        EValueId val = config.tempInputs[i].assignedValue;
+        uint8_t curve = SensorProcessor_curveSlotFor(config, 0, i + 1);
+        if (val != EValueId_VALUE_UNASSIGNED && curve < CURVE_SLOT_COUNT) {
+            SensorProcessor_addCurveInput(config.curves[curve], val, HardwareMap_tempDevice(i), HardwareMap_tempChannel(i), EProcessGroup_PROCESS_TEMPERATURE);
+        } else if (val != EValueId_VALUE_UNASSIGNED) {
+            uint8_t k = SensorProcessor_tempPlanCount;
+            SensorProcessor_tempPlanDevice[k] = HardwareMap_tempDevice(i);
+            SensorProcessor_tempPlanChannel[k] = HardwareMap_tempChannel(i);
+            SensorProcessor_tempPlanDest[k] = val;
+            SensorProcessor_tempPlanSeq[k] = ADS1115Manager_getDecimatedSeq(SensorProcessor_tempPlanDevice[k], SensorProcessor_tempPlanChannel[k]) - 1;
+            NtcTable_build(SensorProcessor_tempPlanTables[k], config.tempInputs[i]);
+            SensorProcessor_tempPlanCount = k + 1;
+        }
+    }
+    SensorProcessor_pressurePlanCount = 0;
+    for (uint8_t i = 0; i < PRESSURE_INPUT_COUNT; i += 1) {
+        EValueId val = config.pressureInputs[i].assignedValue;
+        uint8_t curve = SensorProcessor_curveSlotFor(config, 1, i + 1);
+        if (val != EValueId_VALUE_UNASSIGNED && curve < CURVE_SLOT_COUNT) {
+            SensorProcessor_addCurveInput(config.curves[curve], val, HardwareMap_pressureDevice(i), HardwareMap_pressureChannel(i), EProcessGroup_PROCESS_PRESSURE);
+        } else if (val != EValueId_VALUE_UNASSIGNED) {
+            uint8_t k = SensorProcessor_pressurePlanCount;
+            SensorProcessor_pressurePlanDevice[k] = HardwareMap_pressureDevice(i);
+            SensorProcessor_pressurePlanChannel[k] = HardwareMap_pressureChannel(i);
+            SensorProcessor_pressurePlanDest[k] = val;
+            SensorProcessor_pressurePlanSeq[k] = ADS1115Manager_getDecimatedSeq(SensorProcessor_pressurePlanDevice[k], SensorProcessor_pressurePlanChannel[k]) - 1;
+            SensorProcessor_pressurePlanCoeffs[k] = FixedConvert_pressureCoeffs(config.pressureInputs[i]);
+            SensorProcessor_pressurePlanPulsation[k] = ((config.pulsation.inputMask >> i) & 1) != 0;
+            SensorProcessor_pressurePlanSpanUs[k] = 0;
+            SensorProcessor_pressurePlanCount = k + 1;
+        }
+    }
+    SensorProcessor_pulsationActive = config.pulsation.inputMask != 0;
+    SensorProcessor_pulsationCylinders = config.pulsation.cylinders;
+    SensorProcessor_pulsationMinWindowUs = static_cast<uint32_t>(config.pulsation.windowMs) * 1000;
+    SensorProcessor_atmosphericStale = true;
+    SensorProcessor_slowInputsStale = true;
+    uint32_t nowUs = micros();
+    for (uint8_t g = 0; g < PROCESS_GROUP_COUNT; g += 1) {
+        uint16_t periodMs = config.processPeriodMs[g];
+        if (periodMs == 0) {
+            periodMs = DEFAULT_PROCESS_PERIOD_MS;
+        }
+        SensorProcessor_groupPeriodUs[g] = static_cast<uint32_t>(periodMs) * 1000;
+        SensorProcessor_groupDueUs[g] = nowUs;
+    }
+    SensorProcessor_sensorUpdateReady = true;
+    GlitchFilter_configure(config);
+    SignalFilter_configure(config);
+    RollingStats_configure(config);
+    SpnHold_configure(config);
+}
+
+uint32_t SensorProcessor_getPulsationSpanUs(EValueId val) {
+    for (uint8_t k = 0; k < SensorProcessor_pressurePlanCount; k += 1) {
+        if (SensorProcessor_pressurePlanDest[k] == val && SensorProcessor_pressurePlanPulsation[k]) {
+            return SensorProcessor_pressurePlanSpanUs[k];
+        }
+    }
+    return 0;
 }
 
 void SensorProcessor_initialize(void) {
-    SensorProcessor_sensorTimer.begin(SensorProcessor_sensorTimerISR, 50000);
+    SensorProcessor_armTimer();
+}
+
+void SensorProcessor_acquire(void) {
+    I2cBus_service();
+    ADS1115Manager_update();
+    if (MAX31856Manager_update()) {
+        SensorProcessor_egtPending = true;
+    }
+    if (BME280Manager_update()) {
+        SensorProcessor_bmePending = true;
+    }
 }
 
 void SensorProcessor_update(void) {
-    if (SensorProcessor_sensorUpdateReady) {
-        SensorProcessor_pollAndProcess();
-        SensorProcessor_sensorUpdateReady = false;
+    if (!SensorProcessor_sensorUpdateReady) {
+        return;
+    }
+    SensorProcessor_sensorUpdateReady = false;
+    uint8_t dueMask = SensorProcessor_takeDueGroups(micros());
+    if (dueMask != 0) {
+        SensorProcessor_processAllInputs(dueMask);
     }
+    SensorProcessor_armTimer();
 }
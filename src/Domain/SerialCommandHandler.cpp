@@ -14,11 +14,19 @@
 #include <Parse.hpp>
 #include <AppConfig.h>
 #include <Domain/CommandHandler.h>
+#include <Domain/SensorProcessor.h>
 #include <Display/FaultDecode.h>
 #include <Data/ADS1115Manager.h>
+#include <Data/BME280Manager.h>
+#include <Data/I2cBus.h>
 #include <Data/MAX31856Manager.h>
 #include <Data/SensorValues.h>
+#include <Data/J1939Config.h>
+#include <Display/J1939Bus.h>
 #include <Display/ValueName.h>
+#include <Domain/GlitchFilter.h>
+#include <Domain/RollingStats.h>
+#include <Domain/AlarmMonitor.h>
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -71,6 +79,46 @@ static void SerialCommandHandler_printResult(ECommandResult result) {
             Serial.println("ERR,Invalid NTC param (0-3)");
             break;
         }
+        case ECommandResult_CMD_INVALID_PRIORITY: {
+            Serial.println("ERR,Invalid priority (1-8)");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_DATA_RATE: {
+            Serial.println("ERR,Invalid data rate (0-7)");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_FILTER: {
+            Serial.println("ERR,Invalid filter (0-2)");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_MEDIAN_WINDOW: {
+            Serial.println("ERR,Invalid median window (0/3/5)");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_CURVE: {
+            Serial.println("ERR,Invalid curve");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_STATS: {
+            Serial.println("ERR,Invalid stats slot (1-4) or window (1-1800 s)");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_HOLD: {
+            Serial.println("ERR,Invalid hold mode (0-2) or no such SPN for value");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_PULSATION: {
+            Serial.println("ERR,Invalid pulsation enable (0-1), cylinders (1-16) or window (1-250 ms)");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_ALARM: {
+            Serial.println("ERR,Invalid alarm slot (1-8), limits, hysteresis or debounce (0-10000 ms)");
+            break;
+        }
+        case ECommandResult_CMD_INVALID_CADENCE: {
+            Serial.println("ERR,Invalid group (0-3) or period (5-10000 ms)");
+            break;
+        }
         default: {
             Serial.println("ERR,Unknown error");
             break;
@@ -78,6 +126,190 @@ static void SerialCommandHandler_printResult(ECommandResult result) {
     }
 }
 
+static void SerialCommandHandler_printSampling(uint8_t priority, uint8_t rate) {
+    Serial.print(" (priority ");
+    Serial.print(priority);
+    if (rate < ADS_DATA_RATE_COUNT) {
+        Serial.print(", ");
+        Serial.print(ADS_DATA_RATE_SPS[rate]);
+        Serial.print(" SPS");
+    }
+    Serial.print(")");
+}
+
+static void SerialCommandHandler_printFilters(void) {
+    for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i = i + 1) {
+        EFilterType filterType = appConfig.valueFilters[i].filterType;
+        uint16_t timeConstantMs = appConfig.valueFilters[i].timeConstantMs;
+        if (filterType != EFilterType_FILTER_NONE && timeConstantMs > 0) {
+            Serial.print("filter: ");
+            ValueName_print(static_cast<EValueId>(i));
+            if (filterType == EFilterType_FILTER_IIR2) {
+                Serial.print(" IIR2 ");
+            } else {
+                Serial.print(" EMA ");
+            }
+            Serial.print(timeConstantMs);
+            Serial.println(" ms");
+        }
+    }
+    for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i = i + 1) {
+        EValueId val = static_cast<EValueId>(i);
+        bool deglitched = GlitchFilter_isActive(val);
+        if (deglitched) {
+            Serial.print("glitch: ");
+            ValueName_print(val);
+            Serial.print(" median ");
+            Serial.print(appConfig.valueGlitch[i].medianWindow);
+            Serial.print(", max ");
+            Serial.print(appConfig.valueGlitch[i].maxRatePerSec);
+            Serial.print("/s, rejected ");
+            Serial.println(GlitchFilter_getRejectCount(val));
+        }
+    }
+}
+
+static void SerialCommandHandler_printCurves(void) {
+    for (uint8_t c = 0; c < CURVE_SLOT_COUNT; c = c + 1) {
+        if (appConfig.curves[c].input > 0) {
+            Serial.print("curve");
+            Serial.print(c + 1);
+            if (appConfig.curves[c].inputType == 0) {
+                Serial.print(": temp");
+            } else {
+                Serial.print(": pres");
+            }
+            Serial.print(appConfig.curves[c].input);
+            Serial.print(", ");
+            Serial.print(appConfig.curves[c].pointCount);
+            Serial.println(" points");
+            for (uint8_t p = 0; p < appConfig.curves[c].pointCount; p = p + 1) {
+                Serial.print("  ");
+                Serial.print(appConfig.curves[c].points[p].millivolts);
+                Serial.print(" mV -> ");
+                Serial.println(static_cast<float>(appConfig.curves[c].points[p].valueTenths) / 10.0, 1);
+            }
+        }
+    }
+}
+
+static void SerialCommandHandler_printStats(void) {
+    for (uint8_t s = 0; s < STATS_SLOT_COUNT; s = s + 1) {
+        if (appConfig.stats[s].valueId != static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED)) {
+            Serial.print("stats");
+            Serial.print(s + 1);
+            Serial.print(": ");
+            ValueName_print(static_cast<EValueId>(appConfig.stats[s].valueId));
+            Serial.print(" over ");
+            Serial.print(appConfig.stats[s].windowSec);
+            Serial.println(" s");
+        }
+    }
+}
+
+static void SerialCommandHandler_printHolds(void) {
+    for (uint8_t i = 0; i < SPN_HOLD_COUNT; i = i + 1) {
+        if (appConfig.spnHold[i] != static_cast<uint8_t>(ESpnHold_SPN_HOLD_LATEST)) {
+            Serial.print("hold: ");
+            ValueName_print(SPN_CONFIGS[i].source);
+            if (SPN_CONFIGS[i].spn != 0) {
+                Serial.print(" SPN ");
+                Serial.print(SPN_CONFIGS[i].spn);
+            } else {
+                Serial.print(" PGN ");
+                Serial.print(SPN_CONFIGS[i].pgn);
+            }
+            if (appConfig.spnHold[i] == static_cast<uint8_t>(ESpnHold_SPN_HOLD_MAX)) {
+                Serial.println(" max since last send");
+            } else {
+                Serial.println(" min since last send");
+            }
+        }
+    }
+}
+
+static void SerialCommandHandler_printPulsation(void) {
+    if (appConfig.pulsation.inputMask == 0) {
+        return;
+    }
+    Serial.print("pulsation:");
+    for (uint8_t i = 0; i < PRESSURE_INPUT_COUNT; i = i + 1) {
+        if (((appConfig.pulsation.inputMask >> i) & 1) != 0) {
+            Serial.print(" pres");
+            Serial.print(i + 1);
+            uint32_t spanUs = SensorProcessor_getPulsationSpanUs(appConfig.pressureInputs[i].assignedValue);
+            if (spanUs > 0) {
+                Serial.print(" (");
+                Serial.print(static_cast<float>(spanUs) / 1000.0, 1);
+                Serial.print(" ms)");
+            }
+        }
+    }
+    Serial.print(", ");
+    Serial.print(appConfig.pulsation.cylinders);
+    Serial.print(" cyl, min ");
+    Serial.print(appConfig.pulsation.windowMs);
+    Serial.print(" ms, ");
+    float rpm = J1939Bus_getEngineRpm();
+    if (rpm > 0.0) {
+        Serial.print(rpm, 0);
+        Serial.println(" rpm (EEC1)");
+    } else {
+        Serial.println("no EEC1 engine speed");
+    }
+}
+
+static void SerialCommandHandler_printAlarms(void) {
+    bool any = false;
+    for (uint8_t s = 0; s < ALARM_SLOT_COUNT; s = s + 1) {
+        if (appConfig.alarms[s].valueId != static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED)) {
+            any = true;
+            Serial.print("alarm");
+            Serial.print(s + 1);
+            Serial.print(": ");
+            ValueName_print(static_cast<EValueId>(appConfig.alarms[s].valueId));
+            if (appConfig.alarms[s].lowTenths != ALARM_NO_LOW) {
+                Serial.print(" low ");
+                Serial.print(static_cast<float>(appConfig.alarms[s].lowTenths) / 10.0, 1);
+            }
+            if (appConfig.alarms[s].highTenths != ALARM_NO_HIGH) {
+                Serial.print(" high ");
+                Serial.print(static_cast<float>(appConfig.alarms[s].highTenths) / 10.0, 1);
+            }
+            Serial.print(" hyst ");
+            Serial.print(static_cast<float>(appConfig.alarms[s].hysteresisTenths) / 10.0, 1);
+            Serial.print(" debounce ");
+            Serial.print(appConfig.alarms[s].debounceMs);
+            Serial.print(" ms, ");
+            EAlarmState state = AlarmMonitor_getState(s);
+            if (state == EAlarmState_ALARM_LOW) {
+                Serial.println("LOW");
+            } else if (state == EAlarmState_ALARM_HIGH) {
+                Serial.println("HIGH");
+            } else {
+                Serial.println("normal");
+            }
+        }
+    }
+    if (any) {
+        Serial.print("alarm latency max: ");
+        Serial.print(AlarmMonitor_getLatencyMaxUs());
+        Serial.println(" us");
+    }
+}
+
+static void SerialCommandHandler_printCadence(void) {
+    Serial.print("period: pressure ");
+    Serial.print(appConfig.processPeriodMs[EProcessGroup_PROCESS_PRESSURE]);
+    Serial.print(" ms, temperature ");
+    Serial.print(appConfig.processPeriodMs[EProcessGroup_PROCESS_TEMPERATURE]);
+    Serial.print(" ms, EGT ");
+    Serial.print(appConfig.processPeriodMs[EProcessGroup_PROCESS_EGT]);
+    Serial.print(" ms, BME280 ");
+    Serial.print(appConfig.processPeriodMs[EProcessGroup_PROCESS_BME280]);
+    Serial.println(" ms");
+}
+
 static void SerialCommandHandler_printEnabledValues(void) {
     Serial.println("=== Enabled Values ===");
     for (uint8_t i = 0; i < TEMP_INPUT_COUNT; i = i + 1) {
@@ -87,6 +319,7 @@ static void SerialCommandHandler_printEnabledValues(void) {
             Serial.print(i + 1);
             Serial.print(": ");
             ValueName_print(val);
+            SerialCommandHandler_printSampling(appConfig.tempInputs[i].samplePriority, appConfig.tempInputs[i].dataRate);
             Serial.println();
         }
     }
@@ -97,6 +330,7 @@ static void SerialCommandHandler_printEnabledValues(void) {
             Serial.print(i + 1);
             Serial.print(": ");
             ValueName_print(val);
+            SerialCommandHandler_printSampling(appConfig.pressureInputs[i].samplePriority, appConfig.pressureInputs[i].dataRate);
             Serial.println();
         }
     }
@@ -106,6 +340,13 @@ static void SerialCommandHandler_printEnabledValues(void) {
     if (appConfig.bme280Enabled) {
         Serial.println("BME280: enabled");
     }
+    SerialCommandHandler_printFilters();
+    SerialCommandHandler_printCurves();
+    SerialCommandHandler_printStats();
+    SerialCommandHandler_printHolds();
+    SerialCommandHandler_printPulsation();
+    SerialCommandHandler_printAlarms();
+    SerialCommandHandler_printCadence();
 }
 
 static void SerialCommandHandler_handleQuery(void) {
@@ -257,8 +498,35 @@ static void SerialCommandHandler_handleReadSensors(void) {
             Serial.println(" kPa");
             break;
         }
+        case 5: {
+            Serial.println("=== Rolling Statistics ===");
+            uint32_t now = micros();
+            for (uint8_t s = 0; s < STATS_SLOT_COUNT; s = s + 1) {
+                if (appConfig.stats[s].valueId != static_cast<uint8_t>(EValueId_VALUE_UNASSIGNED)) {
+                    TRollingStats stats = {0};
+                    bool hasSamples = RollingStats_get(s, now, stats);
+                    ValueName_print(static_cast<EValueId>(appConfig.stats[s].valueId));
+                    if (!hasSamples) {
+                        Serial.println(": no samples");
+                    } else {
+                        Serial.print(": min ");
+                        Serial.print(stats.minimum, 2);
+                        Serial.print(", max ");
+                        Serial.print(stats.maximum, 2);
+                        Serial.print(", mean ");
+                        Serial.print(stats.mean, 2);
+                        Serial.print(", sd ");
+                        Serial.print(stats.stddev, 2);
+                        Serial.print(" (");
+                        Serial.print(stats.count);
+                        Serial.println(" samples)");
+                    }
+                }
+            }
+            break;
+        }
         default: {
-            Serial.println("ERR,Sensor type 0-4");
+            Serial.println("ERR,Sensor type 0-5");
             break;
         }
     }
@@ -368,6 +636,8 @@ static void SerialCommandHandler_processCommand(void) {
         }
         case 12: {
             ADS1115Manager_printDebugInfo();
+            BME280Manager_printDebugInfo();
+            I2cBus_printDebugInfo();
             return;
             break;
         }
@@ -0,0 +1,79 @@
+/**
+ * Generated by C-Next Transpiler
+ * A safer C for embedded systems
+ */
+
+#include "SignalFilter.h"
+
+// Signal Filter
+// Optional per-value smoothing between conversion and SensorValues.
+// FILTER_EMA is a first-order exponential moving average; FILTER_IIR2 is a
+// critically damped second-order low-pass built from two EMA stages at
+// half the time constant. The blend factor follows the real interval
+// between readings, alpha = dt / (tau + dt), so uneven sample spacing
+// (scheduler weights, skipped ticks) does not change the response time.
+#include <AppConfig.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Filter state for one value
+/* Scope: SignalFilter */
+static TFilterState SignalFilter_state[EValueId_VALUE_ID_COUNT] = {0};
+static EFilterType SignalFilter_filterType[EValueId_VALUE_ID_COUNT] = {};
+static float SignalFilter_stageTauUs[EValueId_VALUE_ID_COUNT] = {0};
+
+void SignalFilter_configure(const AppConfig& config) {
+    for (uint8_t i = 0; i < EValueId_VALUE_ID_COUNT; i += 1) {
+        EFilterType type = config.valueFilters[i].filterType;
+        float tauUs = static_cast<float>(config.valueFilters[i].timeConstantMs) * 1000.0;
+        if (config.valueFilters[i].timeConstantMs == 0) {
+            type = EFilterType_FILTER_NONE;
+        }
+        if (type == EFilterType_FILTER_IIR2) {
+            tauUs = tauUs * 0.5;
+        }
+        SignalFilter_filterType[i] = type;
+        SignalFilter_stageTauUs[i] = tauUs;
+        SignalFilter_state[i].primed = false;
+    }
+}
+
+bool SignalFilter_isActive(EValueId id) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return false;
+    }
+    return SignalFilter_filterType[id] != EFilterType_FILTER_NONE;
+}
+
+void SignalFilter_reset(EValueId id) {
+    if (id >= EValueId_VALUE_ID_COUNT) {
+        return;
+    }
+    SignalFilter_state[id].primed = false;
+}
+
+float SignalFilter_apply(EValueId id, float sample, uint32_t timestampUs) {
+    bool active = SignalFilter_isActive(id);
+    if (!active) {
+        return sample;
+    }
+    if (!SignalFilter_state[id].primed) {
+        SignalFilter_state[id].stage1 = sample;
+        SignalFilter_state[id].stage2 = sample;
+        SignalFilter_state[id].lastTimestampUs = timestampUs;
+        SignalFilter_state[id].primed = true;
+        return sample;
+    }
+    uint32_t dt = timestampUs - SignalFilter_state[id].lastTimestampUs;
+    if (dt > 0) {
+        SignalFilter_state[id].lastTimestampUs = timestampUs;
+        float alpha = static_cast<float>(dt) / (SignalFilter_stageTauUs[id] + static_cast<float>(dt));
+        SignalFilter_state[id].stage1 = SignalFilter_state[id].stage1 + alpha * (sample - SignalFilter_state[id].stage1);
+        SignalFilter_state[id].stage2 = SignalFilter_state[id].stage2 + alpha * (SignalFilter_state[id].stage1 - SignalFilter_state[id].stage2);
+    }
+    if (SignalFilter_filterType[id] == EFilterType_FILTER_EMA) {
+        return SignalFilter_state[id].stage1;
+    }
+    return SignalFilter_state[id].stage2;
+}
@@ -12,6 +12,8 @@
  */
 #include <Arduino.h>
 #include <AppConfig.h>
+#include <Display/J1939Bus.h>
+#include <Domain/AlarmMonitor.h>
 
 #include <stdint.h>
 
@@ -83,7 +85,13 @@ void TimingDebugHandler_maybeReport(void) {
         Serial.print(" j1939=");
         Serial.print(TimingDebugHandler_maxJ1939);
         Serial.print(" total=");
-        Serial.println(TimingDebugHandler_maxTotal);
+        Serial.print(TimingDebugHandler_maxTotal);
+        Serial.print(" canRx=");
+        Serial.print(J1939Bus_getRxLatencyMaxUs());
+        Serial.print(" alarm=");
+        Serial.println(AlarmMonitor_getLatencyMaxUs());
+        J1939Bus_resetRxLatencyMax();
+        AlarmMonitor_resetLatencyMax();
         TimingDebugHandler_maxSensor = 0;
         TimingDebugHandler_maxSerial = 0;
         TimingDebugHandler_maxJ1939 = 0;
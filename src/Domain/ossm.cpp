@@ -46,6 +46,7 @@ void Ossm_loop(void) {
     if (Ossm_loopTimer >= 500) {
         Ossm_loopTimer = 0;
         TimingDebugHandler_startSensor();
+        SensorProcessor_acquire();
         SensorProcessor_update();
         TimingDebugHandler_finishSensor();
         TimingDebugHandler_startSerial();
@@ -0,0 +1,115 @@
+// Integer pressure path vs the float reference
+// FixedConvert.pressure() must agree with
+// SensorConvert.pressure() to within one Q10 step for every preset, and
+// the shifted J1939 encodings must match the float encoder exactly.
+
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+
+#include "FixedConvert.h"
+#include "SensorConvert.h"
+#include "Presets.h"
+#include "J1939Encode.h"
+#include "J1939Config.h"
+
+// Normalized ADC counts per volt (0.256V / 32768 per count)
+static const float COUNTS_PER_VOLT = 128000.0f;
+static const int32_t FULL_SCALE_COUNTS = 640000;
+static const int32_t STEP_COUNTS = 7;
+static const double Q10_STEP = 1.0 / 1024.0;
+
+// Ambient pressure used for the gauge presets, exact in Q10
+static const int32_t BARO_Q10 = 103757;   // 101.325 kPa, rounded
+
+static TPressureInputConfig presetConfig(uint8_t preset) {
+    TPressureInputConfig cfg = {};
+    cfg.assignedValue = EValueId_VALUE_UNASSIGNED;
+    if (Presets_isBarPreset(preset)) {
+        cfg.maxPressure = Presets_barPresetValue(preset);
+        cfg.pressureType = EPressureType_PRESSURE_TYPE_PSIA;
+    } else {
+        cfg.maxPressure = Presets_psiPresetValue(preset);
+        cfg.pressureType = EPressureType_PRESSURE_TYPE_PSIG;
+    }
+    return cfg;
+}
+
+// One Q10 step, plus the rounding of the float reference itself: its
+// voltage and ratio carry float error relative to full scale, which is
+// coarser than a Q10 step for the 1000+ bar presets
+static double tolerancekPa(float fullScalekPa) {
+    return Q10_STEP + (double)fullScalekPa * 4.0 * FLT_EPSILON;
+}
+
+static void checkPreset(uint8_t preset) {
+    TPressureInputConfig cfg = presetConfig(preset);
+    TPressureFixed coeffs = FixedConvert_pressureCoeffs(cfg);
+    FixedConvert_applyAtmospheric(coeffs, BARO_Q10);
+    float baro = FixedConvert_toFloat(BARO_Q10);
+    float fullScale = SensorConvert_pressure(4.5f, cfg, baro);
+
+    char msg[96];
+    for (int32_t counts = 0; counts <= FULL_SCALE_COUNTS; counts += STEP_COUNTS) {
+        float reference = SensorConvert_pressure((float)counts / COUNTS_PER_VOLT, cfg, baro);
+        int32_t q = FixedConvert_pressure(counts, coeffs);
+        double error = fabs((double)q / 1024.0 - (double)reference);
+        snprintf(msg, sizeof(msg), "preset %u counts %ld: %.4f kPa off",
+                 (unsigned)preset, (long)counts, error);
+        TEST_ASSERT_TRUE_MESSAGE(error <= tolerancekPa(fullScale), msg);
+    }
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_bar_presets_match_float(void) {
+    for (uint8_t preset = 0; preset <= 30; preset++) {
+        if (Presets_isBarPreset(preset)) {
+            checkPreset(preset);
+        }
+    }
+}
+
+void test_psi_presets_match_float(void) {
+    for (uint8_t preset = 0; preset <= 30; preset++) {
+        if (Presets_isPsiPreset(preset)) {
+            checkPreset(preset);
+        }
+    }
+}
+
+// Every SPN with a power-of-two resolution encodes the same through the
+// integer shift as through the float divide, across its whole range
+void test_encode_fixed_matches_encode(void) {
+    uint8_t shifted = 0;
+    char msg[64];
+    for (uint8_t i = 0; i < SPN_CONFIG_COUNT; i++) {
+        TSpnConfig cfg = SPN_CONFIGS[i];
+        uint8_t shift = J1939Encode_fixedShift(cfg.resolution);
+        if (shift == J1939Encode_FIXED_SHIFT_NONE) {
+            continue;
+        }
+        shifted++;
+        int32_t offsetQ10 = FixedConvert_fromFloat(cfg.offset);
+        int32_t maxCount = cfg.dataLength == 2 ? 0xFFFF : 0xFF;
+        int32_t lo = -offsetQ10 - 1024;
+        int32_t hi = ((maxCount + 1) << shift) - offsetQ10 + 1024;
+        snprintf(msg, sizeof(msg), "SPN %u", (unsigned)cfg.spn);
+        for (int32_t q = lo; q <= hi; q++) {
+            uint16_t fixed = J1939Encode_encodeFixed(q, offsetQ10, shift);
+            uint16_t reference = J1939Encode_encode(FixedConvert_toFloat(q), cfg.resolution, cfg.offset);
+            TEST_ASSERT_EQUAL_UINT16_MESSAGE(reference, fixed, msg);
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(0, shifted);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_bar_presets_match_float);
+    RUN_TEST(test_psi_presets_match_float);
+    RUN_TEST(test_encode_fixed_matches_encode);
+    return UNITY_END();
+}
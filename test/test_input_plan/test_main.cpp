@@ -0,0 +1,189 @@
+// Batched input-plan kernels
+// FixedConvert.pressureBatch() and NtcTable.lookupBatch() must give the
+// same results as one pressure()/lookup() call per slot, for full and
+// partial fresh-slot lists. A timing loop reports the host cost of one
+// full 15-input plan (7 pressure + 8 temperature) per tick.
+
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+
+#include "FixedConvert.h"
+#include "NtcTable.h"
+#include "Presets.h"
+
+static const uint8_t PRESSURE_SLOTS = 7;
+static const uint8_t TEMP_SLOTS = 8;
+static const int32_t FULL_SCALE_COUNTS = 640000;
+static const int32_t BARO_Q10 = 103757;   // 101.325 kPa, rounded
+static const uint32_t BENCH_TICKS = 200000;
+
+static const uint8_t PRESSURE_PRESETS[PRESSURE_SLOTS] = {0, 4, 9, 15, 20, 25, 30};
+
+// Structure-of-arrays plan, laid out like SensorProcessor's
+static uint8_t pressureSlots[PRESSURE_SLOTS];
+static int32_t pressureCounts[PRESSURE_SLOTS];
+static TPressureFixed pressureCoeffs[PRESSURE_SLOTS];
+static uint32_t pressureMultiplier[PRESSURE_SLOTS];
+static int32_t pressureIntercept[PRESSURE_SLOTS];
+static int32_t pressureFullScale[PRESSURE_SLOTS];
+static int32_t pressureResults[PRESSURE_SLOTS];
+
+static uint8_t tempSlots[TEMP_SLOTS];
+static int32_t tempCounts[TEMP_SLOTS];
+static TNtcTable tempTables[TEMP_SLOTS];
+static int32_t tempResults[TEMP_SLOTS];
+
+static void buildPlan(void) {
+    for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+        TPressureInputConfig cfg = {};
+        uint8_t preset = PRESSURE_PRESETS[k];
+        if (Presets_isBarPreset(preset)) {
+            cfg.maxPressure = Presets_barPresetValue(preset);
+            cfg.pressureType = EPressureType_PRESSURE_TYPE_PSIA;
+        } else {
+            cfg.maxPressure = Presets_psiPresetValue(preset);
+            cfg.pressureType = EPressureType_PRESSURE_TYPE_PSIG;
+        }
+        pressureCoeffs[k] = FixedConvert_pressureCoeffs(cfg);
+        FixedConvert_applyAtmospheric(pressureCoeffs[k], BARO_Q10);
+        pressureMultiplier[k] = pressureCoeffs[k].multiplier;
+        pressureIntercept[k] = pressureCoeffs[k].interceptQ10;
+        pressureFullScale[k] = pressureCoeffs[k].fullScaleQ10;
+    }
+    for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+        TTempInputConfig cfg = {};
+        uint8_t preset = k % 3;
+        cfg.coeffA = Presets_ntcCoeffA(preset);
+        cfg.coeffB = Presets_ntcCoeffB(preset);
+        cfg.coeffC = Presets_ntcCoeffC(preset);
+        cfg.resistorValue = Presets_ntcResistor(preset);
+        NtcTable_build(tempTables[k], cfg);
+    }
+}
+
+// Spread the counts across the whole range, including both rails
+static void loadCounts(int32_t base) {
+    for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+        pressureCounts[k] = (base + (int32_t)k * 91397) % (FULL_SCALE_COUNTS + 1);
+    }
+    for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+        tempCounts[k] = (base + (int32_t)k * 80021) % (FULL_SCALE_COUNTS + 1);
+    }
+}
+
+void setUp(void) {
+    buildPlan();
+}
+
+void tearDown(void) {}
+
+void test_pressure_batch_matches_single(void) {
+    for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+        pressureSlots[k] = k;
+    }
+    for (int32_t base = 0; base <= FULL_SCALE_COUNTS; base += 613) {
+        loadCounts(base);
+        FixedConvert_pressureBatch(PRESSURE_SLOTS, pressureSlots, pressureCounts, pressureMultiplier,
+                                   pressureIntercept, pressureFullScale, pressureResults);
+        for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+            TEST_ASSERT_EQUAL_INT32(FixedConvert_pressure(pressureCounts[k], pressureCoeffs[k]), pressureResults[k]);
+        }
+    }
+}
+
+void test_temp_batch_matches_single(void) {
+    for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+        tempSlots[k] = k;
+    }
+    for (int32_t base = 0; base <= FULL_SCALE_COUNTS; base += 613) {
+        loadCounts(base);
+        NtcTable_lookupBatch(TEMP_SLOTS, tempSlots, tempCounts, tempTables, tempResults);
+        for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+            TEST_ASSERT_EQUAL_INT32(NtcTable_lookup(tempCounts[k], tempTables[k]), tempResults[k]);
+        }
+    }
+}
+
+// Only the listed fresh slots are written; the rest keep their result
+void test_batch_skips_stale_slots(void) {
+    const int32_t UNTOUCHED = 0x55AA55AA;
+    uint8_t fresh[2] = {5, 1};
+    loadCounts(123457);
+
+    for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+        pressureResults[k] = UNTOUCHED;
+    }
+    for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+        tempResults[k] = UNTOUCHED;
+    }
+    FixedConvert_pressureBatch(2, fresh, pressureCounts, pressureMultiplier,
+                               pressureIntercept, pressureFullScale, pressureResults);
+    NtcTable_lookupBatch(2, fresh, tempCounts, tempTables, tempResults);
+
+    for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+        if (k == 1 || k == 5) {
+            TEST_ASSERT_EQUAL_INT32(FixedConvert_pressure(pressureCounts[k], pressureCoeffs[k]), pressureResults[k]);
+        } else {
+            TEST_ASSERT_EQUAL_INT32(UNTOUCHED, pressureResults[k]);
+        }
+    }
+    for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+        if (k == 1 || k == 5) {
+            TEST_ASSERT_EQUAL_INT32(NtcTable_lookup(tempCounts[k], tempTables[k]), tempResults[k]);
+        } else {
+            TEST_ASSERT_EQUAL_INT32(UNTOUCHED, tempResults[k]);
+        }
+    }
+}
+
+// Host timing of a full 15-input tick, batched and per call. Reported
+// only: host numbers say nothing absolute about the M7
+void test_bench_full_plan(void) {
+    for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+        pressureSlots[k] = k;
+    }
+    for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+        tempSlots[k] = k;
+    }
+
+    volatile int32_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < BENCH_TICKS; t++) {
+        loadCounts((int32_t)(t * 7919u % (uint32_t)FULL_SCALE_COUNTS));
+        FixedConvert_pressureBatch(PRESSURE_SLOTS, pressureSlots, pressureCounts, pressureMultiplier,
+                                   pressureIntercept, pressureFullScale, pressureResults);
+        NtcTable_lookupBatch(TEMP_SLOTS, tempSlots, tempCounts, tempTables, tempResults);
+        sink = sink + pressureResults[t % PRESSURE_SLOTS] + tempResults[t % TEMP_SLOTS];
+    }
+    auto batched = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < BENCH_TICKS; t++) {
+        loadCounts((int32_t)(t * 7919u % (uint32_t)FULL_SCALE_COUNTS));
+        for (uint8_t k = 0; k < PRESSURE_SLOTS; k++) {
+            pressureResults[k] = FixedConvert_pressure(pressureCounts[k], pressureCoeffs[k]);
+        }
+        for (uint8_t k = 0; k < TEMP_SLOTS; k++) {
+            tempResults[k] = NtcTable_lookup(tempCounts[k], tempTables[k]);
+        }
+        sink = sink + pressureResults[t % PRESSURE_SLOTS] + tempResults[t % TEMP_SLOTS];
+    }
+    auto single = std::chrono::steady_clock::now() - start;
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "15-input plan: batched %.1f ns/tick, per call %.1f ns/tick",
+             (double)std::chrono::duration_cast<std::chrono::nanoseconds>(batched).count() / BENCH_TICKS,
+             (double)std::chrono::duration_cast<std::chrono::nanoseconds>(single).count() / BENCH_TICKS);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_NOT_EQUAL(0, sink);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_pressure_batch_matches_single);
+    RUN_TEST(test_temp_batch_matches_single);
+    RUN_TEST(test_batch_skips_stale_slots);
+    RUN_TEST(test_bench_full_plan);
+    return UNITY_END();
+}
@@ -0,0 +1,91 @@
+// NTC lookup tables vs the Steinhart-Hart equation
+// For every built-in preset, NtcTable.lookup() must stay within 0.05°C of
+// SensorConvert.ntcTemperature() inside the table, clamp to the end
+// temperatures beyond it, and return ERROR_Q10 at both rails.
+
+#include <unity.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "NtcTable.h"
+#include "SensorConvert.h"
+#include "Presets.h"
+
+// Normalized ADC counts per volt (0.256V / 32768 per count)
+static const float COUNTS_PER_VOLT = 128000.0f;
+static const int32_t FULL_SCALE_COUNTS = 640000;
+static const int32_t TABLE_LAST = 128;
+static const int32_t TABLE_MIN_Q10 = -50 * 1024;
+static const int32_t TABLE_MAX_Q10 = 206 * 1024;
+static const double MAX_ERROR_C = 0.05;
+
+static TTempInputConfig presetConfig(uint8_t preset) {
+    TTempInputConfig cfg = {};
+    cfg.assignedValue = EValueId_VALUE_UNASSIGNED;
+    cfg.coeffA = Presets_ntcCoeffA(preset);
+    cfg.coeffB = Presets_ntcCoeffB(preset);
+    cfg.coeffC = Presets_ntcCoeffC(preset);
+    cfg.resistorValue = Presets_ntcResistor(preset);
+    return cfg;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Every count strictly inside the table interpolates to within 0.05°C
+void test_lookup_matches_equation(void) {
+    char msg[80];
+    for (uint8_t preset = 0; Presets_isValidNtcPreset(preset); preset++) {
+        TTempInputConfig cfg = presetConfig(preset);
+        TNtcTable table;
+        NtcTable_build(table, cfg);
+
+        for (int32_t counts = table.counts[TABLE_LAST] + 1; counts < table.counts[0]; counts++) {
+            float exact = SensorConvert_ntcTemperature((float)counts / COUNTS_PER_VOLT, cfg);
+            double error = fabs((double)NtcTable_lookup(counts, table) / 1024.0 - (double)exact);
+            snprintf(msg, sizeof(msg), "preset %u counts %ld: %.4f C off",
+                     (unsigned)preset, (long)counts, error);
+            TEST_ASSERT_TRUE_MESSAGE(error <= MAX_ERROR_C, msg);
+        }
+    }
+}
+
+// Readings past either end of the table hold that end's temperature
+void test_lookup_clamps_at_table_ends(void) {
+    for (uint8_t preset = 0; Presets_isValidNtcPreset(preset); preset++) {
+        TNtcTable table;
+        NtcTable_build(table, presetConfig(preset));
+
+        for (int32_t counts = table.counts[0]; counts < FULL_SCALE_COUNTS; counts++) {
+            TEST_ASSERT_EQUAL_INT32(TABLE_MIN_Q10, NtcTable_lookup(counts, table));
+        }
+        for (int32_t counts = 1; counts <= table.counts[TABLE_LAST]; counts++) {
+            TEST_ASSERT_EQUAL_INT32(TABLE_MAX_Q10, NtcTable_lookup(counts, table));
+        }
+    }
+}
+
+// An open or shorted sensor reads -273.15°C, like the float path
+void test_lookup_errors_at_rails(void) {
+    for (uint8_t preset = 0; Presets_isValidNtcPreset(preset); preset++) {
+        TTempInputConfig cfg = presetConfig(preset);
+        TNtcTable table;
+        NtcTable_build(table, cfg);
+
+        TEST_ASSERT_EQUAL_INT32(NtcTable_ERROR_Q10, NtcTable_lookup(0, table));
+        TEST_ASSERT_EQUAL_INT32(NtcTable_ERROR_Q10, NtcTable_lookup(-1, table));
+        TEST_ASSERT_EQUAL_INT32(NtcTable_ERROR_Q10, NtcTable_lookup(FULL_SCALE_COUNTS, table));
+        TEST_ASSERT_EQUAL_INT32(NtcTable_ERROR_Q10, NtcTable_lookup(FULL_SCALE_COUNTS + 1, table));
+
+        float railC = SensorConvert_ntcTemperature(0.0f, cfg);
+        TEST_ASSERT_TRUE(fabs((double)NtcTable_ERROR_Q10 / 1024.0 - (double)railC) < 1.0 / 1024.0);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_lookup_matches_equation);
+    RUN_TEST(test_lookup_clamps_at_table_ends);
+    RUN_TEST(test_lookup_errors_at_rails);
+    return UNITY_END();
+}